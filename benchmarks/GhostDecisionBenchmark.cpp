@@ -0,0 +1,273 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Measures how many ghost direction decisions can be made per second, and
+// how fast games play when the level profiles make the ghosts measure
+// distances in a straight line or along the maze.
+//
+// Usage: ghost_decision_benchmark [iterations] [maze file]
+//
+// The maze attributes and the level profiles are read from the directory
+// of the maze file.
+
+#include "Grid2D/MazeLayout.h"
+#include "Grid2D/NavigationTable.h"
+#include "Grid2D/DistanceTable.h"
+#include "PathFinders/GhostDecisionKernel.h"
+#include "Core/LevelRules.h"
+#include "Core/Simulation.h"
+#include "Common/Random.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    /**
+     * @brief A decision a ghost has to make
+     */
+    struct Scenario {
+        int row;
+        int colm;
+        int targetRow;
+        int targetColm;
+        pm::DirectionCandidates candidates;
+    };
+
+    /**
+     * @brief The decision as it was made before the kernel was introduced
+     *
+     * It is kept here as a baseline for the kernel
+     */
+    pm::Dir legacyMinDistanceDirection(const Scenario& scenario) {
+        std::vector<pm::Dir> possibleDirections(scenario.candidates.dirs, scenario.candidates.dirs + scenario.candidates.count);
+        std::vector<double> weights;
+
+        for (const auto& dir : possibleDirections) {
+            int adjRow = scenario.row + pm::rowOffset(dir);
+            int adjColm = scenario.colm + pm::colmOffset(dir);
+            weights.push_back(std::sqrt(std::pow(scenario.targetRow - adjRow, 2.0) + std::pow(scenario.targetColm - adjColm, 2.0)));
+        }
+
+        auto minDistance = std::numeric_limits<double>::max();
+        int index = -1;
+        for (int i = 0; i < static_cast<int>(weights.size()); i++) {
+            if (weights[i] < minDistance) {
+                minDistance = weights[i];
+                index = i;
+            }
+        }
+
+        return index == -1 ? possibleDirections.front() : possibleDirections[index];
+    }
+
+    /**
+     * @brief Run a decision function over all scenarios and print its throughput
+     * @param name The name of the benchmark
+     * @param scenarios The decisions to be made
+     * @param iterations The number of times each scenario is decided
+     * @param decide The decision function
+     * @return A checksum of the decisions, so they are not optimized away
+     */
+    template <typename DecisionFunc>
+    unsigned run(const char* name, const std::vector<Scenario>& scenarios, int iterations, DecisionFunc decide) {
+        unsigned checksum = 0;
+        auto start = std::chrono::steady_clock::now();
+
+        for (int i = 0; i < iterations; i++) {
+            for (const auto& scenario : scenarios)
+                checksum = checksum * 31u + static_cast<unsigned>(decide(scenario));
+        }
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        double decisions = static_cast<double>(scenarios.size()) * iterations;
+        std::printf("%-24s %12.0f decisions/s  (%.3f s)\n", name, decisions / elapsed.count(), elapsed.count());
+        return checksum;
+    }
+
+    /**
+     * @brief Play games for a number of steps and print the throughput
+     * @param name The name of the benchmark
+     * @param simulation The simulation to play the games with
+     * @param steps The number of steps to play
+     * @return The sum of the scores of the games, which depends on how
+     *         the ghosts chose their directions
+     */
+    long long play(const char* name, const pm::Simulation& simulation, long long steps) {
+        pm::GameState state;
+        std::uint64_t seed = 0;
+        simulation.reset(state, seed);
+
+        // The same inputs for both simulations, so only the ghosts differ
+        pm::Random random{12345};
+        long long scores = 0;
+        auto start = std::chrono::steady_clock::now();
+
+        for (long long i = 0; i < steps; i++) {
+            if (state.phase == pm::GamePhase::GameOver) {
+                scores += state.score;
+                simulation.reset(state, ++seed);
+            }
+
+            pm::Dir input = random.nextInt(0, 7) < 4 ? static_cast<pm::Dir>(random.nextInt(0, 3)) : pm::Dir::None;
+            simulation.step(state, input);
+        }
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::printf("%-24s %12.0f steps/s  (%.3f s, %llu games)\n", name, static_cast<double>(steps) / elapsed.count(), elapsed.count(),
+            static_cast<unsigned long long>(seed + 1));
+        return scores + state.score;
+    }
+
+    /**
+     * @brief Load level profiles in which every level uses one ghost
+     *        target strategy
+     * @param filename The level profiles file to start from
+     * @param distance The distance column of every level, "Straight" or "Path"
+     * @param rules The rules to load the profiles into
+     * @return True if the profiles were loaded, otherwise false
+     */
+    bool loadProfiles(const std::string& filename, const std::string& distance, pm::LevelRules& rules) {
+        std::ifstream file(filename);
+        std::ostringstream profiles;
+        std::string line;
+
+        // The distance is the last column of a level
+        while (std::getline(file, line)) {
+            std::size_t end = line.find_last_not_of(" \t\r");
+            if (!line.empty() && line[0] != '#' && end != std::string::npos)
+                line = line.substr(0, line.find_last_of(" \t", end) + 1) + distance;
+
+            profiles << line << '\n';
+        }
+
+        std::istringstream stream(profiles.str());
+        return file.eof() && rules.loadFromStream(stream);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 2000;
+    std::string mazeFile = argc > 2 ? argv[2] : PACMAN_MAZE_FILE;
+
+    pm::MazeLayout layout = pm::loadMazeLayout(mazeFile);
+    if (layout.empty()) {
+        std::fprintf(stderr, "Failed to load maze from '%s'\n", mazeFile.c_str());
+        return EXIT_FAILURE;
+    }
+
+    pm::NavigationTable navTable;
+    navTable.create(layout);
+    pm::DistanceTable distances;
+    distances.create(navTable);
+
+    // Pacman's spawn tile is used to discard tiles that cannot be reached from the maze
+    const int originRow = 25, originColm = 16;
+    std::vector<std::pair<int, int>> reachableTiles;
+
+    for (int row = 0; row < navTable.getRowCount(); row++) {
+        for (int colm = 0; colm < navTable.getColumnCount(); colm++) {
+            if (distances.getDistance(originRow, originColm, row, colm) != pm::DistanceTable::UNREACHABLE)
+                reachableTiles.emplace_back(row, colm);
+        }
+    }
+
+    // Every decision a ghost can face: each reachable tile entered from each direction
+    std::vector<Scenario> scenarios;
+    const pm::Dir directions[] = {pm::Dir::Up, pm::Dir::Left, pm::Dir::Down, pm::Dir::Right};
+
+    for (std::size_t i = 0; i < reachableTiles.size(); i++) {
+        auto [row, colm] = reachableTiles[i];
+
+        for (pm::Dir dir : directions) {
+            auto candidates = pm::GhostDecisionKernel::getCandidates(navTable.getExits(row, colm), pm::dirBit(pm::reverseDir(dir)));
+            if (candidates.count < 2)
+                continue;
+
+            auto [targetRow, targetColm] = reachableTiles[(i * 7919u + static_cast<unsigned>(dir) * 104729u) % reachableTiles.size()];
+            scenarios.push_back({row, colm, targetRow, targetColm, candidates});
+        }
+    }
+
+    std::printf("%zu decision scenarios, %d iterations\n", scenarios.size(), iterations);
+
+    unsigned checksum = 0;
+    checksum ^= run("legacy (vector + sqrt)", scenarios, iterations, [](const Scenario& s) {
+        return legacyMinDistanceDirection(s);
+    });
+
+    checksum ^= run("kernel straight-line", scenarios, iterations, [](const Scenario& s) {
+        return pm::GhostDecisionKernel::getMinDistanceDirection(s.candidates, s.row, s.colm, s.targetRow, s.targetColm);
+    });
+
+    checksum ^= run("kernel path distance", scenarios, iterations, [&distances](const Scenario& s) {
+        return pm::GhostDecisionKernel::getMinPathDistanceDirection(s.candidates, distances, s.row, s.colm, s.targetRow, s.targetColm);
+    });
+
+    std::uint32_t state = 2463534242u;
+    checksum ^= run("kernel random", scenarios, iterations, [&state](const Scenario& s) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return pm::GhostDecisionKernel::getRandomDirection(s.candidates, state);
+    });
+
+    // The kernel must make the same decisions as the implementation it replaced
+    for (const auto& scenario : scenarios) {
+        if (legacyMinDistanceDirection(scenario) != pm::GhostDecisionKernel::getMinDistanceDirection(scenario.candidates,
+            scenario.row, scenario.colm, scenario.targetRow, scenario.targetColm))
+        {
+            std::fprintf(stderr, "Kernel decision differs from the legacy decision at tile (%d, %d)\n", scenario.row, scenario.colm);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Whole games, the ghosts choose through the strategy of the level profiles
+    std::string mazeDir = mazeFile.substr(0, mazeFile.find_last_of("/\\") + 1);
+    pm::Maze maze;
+    pm::LevelRules straightRules, pathRules;
+
+    if (!maze.loadFromFile(mazeFile, mazeDir + "maze_attributes.txt")
+        || !loadProfiles(mazeDir + "level_profiles.txt", "Straight", straightRules)
+        || !loadProfiles(mazeDir + "level_profiles.txt", "Path", pathRules))
+    {
+        std::fprintf(stderr, "Failed to load the maze attributes or the level profiles from '%s'\n", mazeDir.c_str());
+        return EXIT_FAILURE;
+    }
+
+    const long long steps = static_cast<long long>(iterations) * 1000;
+    long long straightScores = play("simulation straight-line", pm::Simulation{maze, straightRules}, steps);
+    long long pathScores = play("simulation path distance", pm::Simulation{maze, pathRules}, steps);
+
+    if (straightScores == pathScores)
+        std::printf("warning: the ghost target strategy did not change the games\n");
+
+    std::printf("checksum: %u\n", checksum);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,158 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Measures how many simulation steps (of one and of several ticks),
+// snapshot captures and restores and observation plane encodes can be
+// made per second.
+//
+// Usage: simulation_step_benchmark [steps] [maze directory]
+
+#include "Core/Simulation.h"
+#include "Core/LevelRules.h"
+#include "Core/Snapshot.h"
+#include "Core/PlaneEncoder.h"
+#include "Common/Random.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    long long steps = argc > 1 ? std::atoll(argv[1]) : 10000000;
+    std::string mazeDir = argc > 2 ? argv[2] : PACMAN_MAZE_DIR;
+
+    pm::Maze maze;
+    if (!maze.loadFromFile(mazeDir + "/maze.txt", mazeDir + "/maze_attributes.txt")) {
+        std::fprintf(stderr, "Failed to load maze from '%s'\n", mazeDir.c_str());
+        return EXIT_FAILURE;
+    }
+
+    pm::LevelRules levelRules;
+    if (!levelRules.loadFromFile(mazeDir + "/level_profiles.txt")) {
+        std::fprintf(stderr, "Failed to load the level profiles from '%s'\n", mazeDir.c_str());
+        return EXIT_FAILURE;
+    }
+
+    pm::Simulation simulation{maze, levelRules};
+    pm::GameState state;
+    std::uint64_t seed = 0;
+    simulation.reset(state, seed);
+
+    // Random key presses, drawn up front so that only the simulation is measured
+    pm::Random random{12345};
+    std::vector<pm::Dir> inputs(4096);
+    for (auto& input : inputs)
+        input = random.nextInt(0, 7) < 4 ? static_cast<pm::Dir>(random.nextInt(0, 3)) : pm::Dir::None;
+
+    int games = 1;
+    long long checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (long long i = 0; i < steps; i++) {
+        if (state.phase == pm::GamePhase::GameOver) {
+            checksum += state.score;
+            simulation.reset(state, ++seed);
+            games++;
+        }
+
+        simulation.step(state, inputs[static_cast<std::size_t>(i) % inputs.size()]);
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::printf("%-24s %12.0f steps/s  (%.3f s, %d games)\n", "simulation step", static_cast<double>(steps) / elapsed.count(), elapsed.count(), games);
+
+    // Accelerated runs cover several ticks per step, compare in ticks per
+    // second with the steps of a single tick above
+    const unsigned int ticksPerStep = 8;
+    long long coarseSteps = steps / ticksPerStep;
+    simulation.reset(state, ++seed);
+    games++;
+    start = std::chrono::steady_clock::now();
+
+    for (long long i = 0; i < coarseSteps; i++) {
+        if (state.phase == pm::GamePhase::GameOver) {
+            checksum += state.score;
+            simulation.reset(state, ++seed);
+            games++;
+        }
+
+        simulation.step(state, inputs[static_cast<std::size_t>(i) % inputs.size()], ticksPerStep * pm::Simulation::TIMESTEP);
+    }
+
+    elapsed = std::chrono::steady_clock::now() - start;
+    std::printf("%-24s %12.0f ticks/s  (%.3f s, %u ticks per step)\n", "simulation coarse step", static_cast<double>(coarseSteps * ticksPerStep) / elapsed.count(), elapsed.count(), ticksPerStep);
+
+    // Capturing and restoring states is what rewinding and search based
+    // players do the most
+    const int copies = 1000000;
+    std::vector<pm::Snapshot> snapshots(16);
+    start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < copies; i++) {
+        snapshots[static_cast<std::size_t>(i) % snapshots.size()].capture(state);
+        state.tick++;
+    }
+
+    elapsed = std::chrono::steady_clock::now() - start;
+    std::printf("%-24s %12.0f captures/s  (%.3f s, %zu bytes)\n", "snapshot capture", copies / elapsed.count(), elapsed.count(), sizeof(pm::GameState));
+
+    start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < copies; i++) {
+        snapshots[static_cast<std::size_t>(i) % snapshots.size()].restore(state);
+        checksum += static_cast<long long>(state.tick);
+    }
+
+    elapsed = std::chrono::steady_clock::now() - start;
+    std::printf("%-24s %12.0f restores/s  (%.3f s)\n", "snapshot restore", copies / elapsed.count(), elapsed.count());
+
+    // Observations are encoded once per agent step
+    const int encodes = 200000;
+    pm::PlaneEncoder encoder{maze};
+    std::vector<std::uint8_t> bytePlanes(encoder.getObservationSize());
+    std::vector<float> floatPlanes(encoder.getObservationSize());
+    start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < encodes; i++) {
+        encoder.encode(state, bytePlanes.data());
+        checksum += bytePlanes[static_cast<std::size_t>(i) % bytePlanes.size()];
+    }
+
+    elapsed = std::chrono::steady_clock::now() - start;
+    std::printf("%-24s %12.0f encodes/s  (%.3f s, %zu values)\n", "plane encode (uint8)", encodes / elapsed.count(), elapsed.count(), bytePlanes.size());
+
+    start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < encodes; i++) {
+        encoder.encode(state, floatPlanes.data());
+        checksum += static_cast<long long>(floatPlanes[static_cast<std::size_t>(i) % floatPlanes.size()]);
+    }
+
+    elapsed = std::chrono::steady_clock::now() - start;
+    std::printf("%-24s %12.0f encodes/s  (%.3f s)\n", "plane encode (float)", encodes / elapsed.count(), elapsed.count());
+
+    std::printf("checksum: %lld\n", checksum + state.score);
+    return EXIT_SUCCESS;
+}
@@ -22,25 +22,23 @@
 // SOFTWARE.
 ////////////////////////////////////////////////////////////////////////////////
 
-#include "ObjectReferenceKeeper.h"
+#include "GhostPersonality.h"
 #include <cassert>
+#include <iterator>
 
 namespace pm {
     ///////////////////////////////////////////////////////////////
-    void ObjectReferenceKeeper::registerActor(ime::GridObject *gameObject) {
-        assert(gameObject);
-        gameObjects_.insert({gameObject->getTag(), gameObject});
-    }
+    const GhostPersonality& GhostPersonality::get(Ghost::Colour colour) {
+        static const GhostPersonality personalities[] = {
+            {"blinky", 0},
+            {"pinky",  1},
+            {"inky",   2},
+            {"clyde",  3}
+        };
 
-    ///////////////////////////////////////////////////////////////
-    ime::GridObject* ObjectReferenceKeeper::getActor(const std::string &tag) {
-        auto found = gameObjects_.find(tag);
-        return found != gameObjects_.end() ? found->second : nullptr;
-    }
-
-    ///////////////////////////////////////////////////////////////
-    void ObjectReferenceKeeper::clear() {
-        gameObjects_.clear();
+        auto index = static_cast<std::size_t>(colour);
+        assert(index < std::size(personalities) && "Unknown ghost colour");
+        return personalities[index];
     }
 
 } // namespace pm
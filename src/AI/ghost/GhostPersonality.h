@@ -22,39 +22,30 @@
 // SOFTWARE.
 ////////////////////////////////////////////////////////////////////////////////
 
-#ifndef PACMAN_GIDLESTATE_H
-#define PACMAN_GIDLESTATE_H
+#ifndef PACMAN_GHOSTPERSONALITY_H
+#define PACMAN_GHOSTPERSONALITY_H
 
-#include "GhostState.h"
+#include "GameObjects/Ghost.h"
 
 namespace pm {
     /**
-     * @brief A ghosts idle state
+     * @brief Defines what makes a ghost look different from the other ghosts
      *
-     * In this state, the ghost cannot remains at its current position
-     * and cannot move around the maze
+     * A personality is looked up once when a ghost is constructed, so the
+     * ghost never has to find out who it is by comparing tags. How a ghost
+     * behaves is defined by pm::Simulation
      */
-    class GIdleState final : public GhostState {
-    public:
-        /**
-         * @brief Constructor
-         * @param fsm The ghosts Finite State Machine
-         * @param ghost The ghost whose behaviour is to be defined by this state
-         */
-        GIdleState(ActorStateFSM* fsm, Ghost* ghost);
-
-        /**
-         * @brief Initialize the state
-         */
-        void onEntry() override;
+    struct GhostPersonality {
+        const char* tag;    //!< The tag of the ghost
+        int spriteSheetRow; //!< The row of the ghost's frames in the sprite sheet
 
         /**
-         * @brief Handle a game event
-         * @param event The event to be handled
-         * @param args Event arguments
+         * @brief Get the personality of a ghost
+         * @param colour The colour of the ghost
+         * @return The personality of the ghost with the given colour
          */
-        void handleEvent(GameEvent event, const ime::PropertyContainer &args) override;
+        static const GhostPersonality& get(Ghost::Colour colour);
     };
 }
 
-#endif
+#endif //PACMAN_GHOSTPERSONALITY_H
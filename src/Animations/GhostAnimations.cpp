@@ -32,9 +32,9 @@ namespace pm {
     {}
 
     ///////////////////////////////////////////////////////////////
-    void GhostAnimations::createAnimations(const std::string& tag) {
+    void GhostAnimations::createAnimations(int spriteSheetRow) {
         animations_.clear();
-        createMovementAnimations(tag);
+        createMovementAnimations(spriteSheetRow);
         createEatenAnimations();
         createFrightenedAnimations();
     }
@@ -54,19 +54,8 @@ namespace pm {
     }
 
     ///////////////////////////////////////////////////////////////
-    void GhostAnimations::createMovementAnimations(const std::string& tag) {
-        int row = -1;
-        if (tag == "blinky")
-            row = 0;
-        else if (tag == "pinky")
-            row = 1;
-        else if (tag == "inky")
-            row = 2;
-        else if (tag == "clyde")
-            row = 3;
-        else {
-            assert(false && "Failed to construct ghost animation: Invalid tag");
-        }
+    void GhostAnimations::createMovementAnimations(int row) {
+        assert(row >= 0 && row <= 3 && "Failed to construct ghost animation: Invalid sprite sheet row");
 
         createAnimation("goingLeft", {row, 0});
         createAnimation("goingUp", {row, 2});
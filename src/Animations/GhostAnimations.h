@@ -41,16 +41,18 @@ namespace pm {
         GhostAnimations();
 
         /**
-         * @brief Create Animations for a ghost with the specified name
-         * @param tag The tag of the ghost
+         * @brief Create Animations for a ghost
+         * @param spriteSheetRow The row of the ghost's frames in the sprite sheet
          *
-         * This function recognises the following tags:
-         * 1. "blinky" = Red ghost
-         * 2. "pinky"  = Pink ghost
-         * 3. "inky"   = Cyan ghost
-         * 4. "clyde"  = Orange ghost
+         * The sprite sheet rows are as follows:
+         * 0 = Red ghost (blinky)
+         * 1 = Pink ghost (pinky)
+         * 2 = Cyan ghost (inky)
+         * 3 = Orange ghost (clyde)
+         *
+         * @see pm::GhostPersonality::spriteSheetRow
          */
-        void createAnimations(const std::string& tag);
+        void createAnimations(int spriteSheetRow);
 
         /**
          * @brief Get all of the created Animations
@@ -68,9 +70,9 @@ namespace pm {
 
         /**
          * @brief Create normal and flat PathFinders Animations
-         * @param tag The tag of the ghost to create the animation for
+         * @param row The sprite sheet row of the ghost to create the animation for
          */
-        void createMovementAnimations(const std::string& tag);
+        void createMovementAnimations(int row);
 
         /**
          * @brief Create Animations for when the ghost is frightened
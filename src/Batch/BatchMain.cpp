@@ -22,17 +22,12 @@
 // SOFTWARE.
 ////////////////////////////////////////////////////////////////////////////////
 
-#include "GhostState.h"
-#include <cassert>
+#include "Batch/BatchRunner.h"
 
-namespace pm {
-    ///////////////////////////////////////////////////////////////
-    GhostState::GhostState(ActorStateFSM* fsm, Ghost* ghost) :
-        fsm_{fsm},
-        ghost_{ghost}
-    {
-        assert(ghost && "Ghost must not be a nullptr");
-        assert(fsm_ && "A ghost's FSM cannot be a nullptr");
-    }
+int main(int argc, char* argv[]) {
+    pm::BatchRunner batchRunner{};
+    if (!batchRunner.initialize(argc, argv))
+        return batchRunner.isHelpRequested() ? 0 : 1;
 
-} // namespace pm
+    return batchRunner.start() ? 0 : 1;
+}
@@ -0,0 +1,260 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "BatchRunner.h"
+#include "Core/Simulation.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+namespace pm {
+    ///////////////////////////////////////////////////////////////
+    BatchRunner::BatchRunner() :
+        firstSeed_{0},
+        gameCount_{1000},
+        threadCount_{std::max(1u, std::thread::hardware_concurrency())},
+        maxTicks_{static_cast<std::uint64_t>(60 * 60 / Simulation::TIMESTEP)},
+        outputFile_{"batch_summary.csv"},
+        mazeDir_{"res/TextFiles/"},
+        isHelpRequested_{false}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    bool BatchRunner::initialize(int argc, char* argv[]) {
+        for (int i = 1; i < argc; i++) {
+            std::string option = argv[i];
+
+            if (option == "--help" || option == "-h") {
+                isHelpRequested_ = true;
+                printUsage();
+                return false;
+            }
+
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for option " << option << std::endl;
+                return false;
+            }
+
+            std::string value = argv[++i];
+
+            try {
+                if (option == "--games")
+                    gameCount_ = static_cast<unsigned int>(std::stoul(value));
+                else if (option == "--seed")
+                    firstSeed_ = std::stoull(value);
+                else if (option == "--threads")
+                    threadCount_ = std::max(1u, static_cast<unsigned int>(std::stoul(value)));
+                else if (option == "--ticks")
+                    maxTicks_ = std::stoull(value);
+                else if (option == "--input")
+                    inputFile_ = value;
+                else if (option == "--output")
+                    outputFile_ = value;
+                else if (option == "--maze-dir")
+                    mazeDir_ = value + "/";
+                else {
+                    std::cerr << "Unknown option " << option << std::endl;
+                    return false;
+                }
+            } catch (const std::exception&) {
+                std::cerr << "Invalid value for option " << option << ": " << value << std::endl;
+                return false;
+            }
+        }
+
+        if (!maze_.loadFromFile(mazeDir_ + "maze.txt", mazeDir_ + "maze_attributes.txt")) {
+            std::cerr << "Failed to load the maze from " << mazeDir_ << std::endl;
+            return false;
+        }
+
+        if (!levelRules_.loadFromFile(mazeDir_ + "level_profiles.txt")) {
+            std::cerr << "Failed to load the level profiles from " << mazeDir_ << std::endl;
+            return false;
+        }
+
+        if (!inputFile_.empty() && !input_.loadFromFile(inputFile_)) {
+            std::cerr << "Failed to load the input script " << inputFile_ << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool BatchRunner::isHelpRequested() const {
+        return isHelpRequested_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void BatchRunner::printUsage() {
+        std::cout << "Usage: pacman_batch [options]\n"
+                     "  --games <number>    The number of games to play (default: 1000)\n"
+                     "  --seed <number>     The seed of the first game (default: 0)\n"
+                     "  --threads <number>  The number of worker threads (default: one per core)\n"
+                     "  --ticks <number>    The maximum number of steps per game (default: one hour of game time)\n"
+                     "  --input <filename>  The input script every game plays (default: random key presses generated from each seed)\n"
+                     "  --output <filename> The summary file (default: batch_summary.csv)\n"
+                     "  --maze-dir <dir>    The directory that contains maze.txt, maze_attributes.txt and level_profiles.txt (default: res/TextFiles/)\n"
+                     "  --help, -h          Print the options and exit" << std::endl;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool BatchRunner::start() {
+        results_.assign(gameCount_, GameResult{});
+        workers_.assign(threadCount_, WorkerStats{});
+        queues_.clear();
+
+        for (unsigned int i = 0; i < threadCount_; i++)
+            queues_.push_back(std::make_unique<WorkStealingQueue<unsigned int>>());
+
+        // Deal the games out like cards, so neighbouring seeds land on different workers
+        for (unsigned int game = 0; game < gameCount_; game++)
+            queues_[game % threadCount_]->push(game);
+
+        auto startTime = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> threads;
+        for (unsigned int i = 1; i < threadCount_; i++)
+            threads.emplace_back(&BatchRunner::work, this, i);
+
+        work(0);
+
+        for (auto& thread : threads)
+            thread.join();
+
+        std::chrono::duration<double> wallTime = std::chrono::steady_clock::now() - startTime;
+
+        // Throughput report
+        std::uint64_t totalTicks = 0;
+        for (unsigned int i = 0; i < threadCount_; i++) {
+            const WorkerStats& stats = workers_[i];
+            totalTicks += stats.ticks;
+
+            std::cout << "thread " << i << ": " << stats.games << " games, " << stats.steals << " stolen, "
+                      << stats.ticks << " ticks, busy " << stats.busyTime << " s, "
+                      << static_cast<std::uint64_t>(stats.busyTime > 0.0 ? static_cast<double>(stats.ticks) / stats.busyTime : 0.0)
+                      << " ticks/s\n";
+        }
+
+        std::cout << "total: " << gameCount_ << " games on " << threadCount_ << " threads in " << wallTime.count() << " s, "
+                  << static_cast<std::uint64_t>(wallTime.count() > 0.0 ? static_cast<double>(totalTicks) / wallTime.count() : 0.0)
+                  << " ticks/s" << std::endl;
+
+        if (!saveSummary(wallTime.count())) {
+            std::cerr << "Failed to write the summary file " << outputFile_ << std::endl;
+            return false;
+        }
+
+        std::cout << "summary written to " << outputFile_ << std::endl;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void BatchRunner::work(unsigned int worker) {
+        while (true) {
+            std::optional<unsigned int> game = queues_[worker]->pop();
+
+            // No game creates other games, so once every queue is empty the batch is done
+            for (unsigned int i = 1; !game && i < threadCount_; i++) {
+                game = queues_[(worker + i) % threadCount_]->steal();
+
+                if (game)
+                    workers_[worker].steals++;
+            }
+
+            if (!game)
+                return;
+
+            playGame(*game, worker);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void BatchRunner::playGame(unsigned int game, unsigned int worker) {
+        auto startTime = std::chrono::steady_clock::now();
+
+        std::uint64_t seed = firstSeed_ + game;
+        Simulation simulation{maze_, levelRules_};
+        GameState state;
+        simulation.reset(state, seed);
+
+        if (inputFile_.empty()) {
+            InputScript input;
+            input.generate(seed, maxTicks_);
+            input.play(simulation, state, maxTicks_);
+        } else
+            input_.play(simulation, state, maxTicks_);
+
+        std::chrono::duration<double> wallTime = std::chrono::steady_clock::now() - startTime;
+
+        GameResult& result = results_[game];
+        result.seed = seed;
+        result.score = state.score;
+        result.level = state.level;
+        result.deaths = state.deaths;
+        result.ticks = state.tick;
+        result.wallTime = wallTime.count();
+        result.thread = worker;
+
+        WorkerStats& stats = workers_[worker];
+        stats.games++;
+        stats.ticks += state.tick;
+        stats.busyTime += wallTime.count();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool BatchRunner::saveSummary(double wallTime) const {
+        std::ofstream file(outputFile_);
+        if (!file)
+            return false;
+
+        std::uint64_t totalTicks = 0;
+        long long totalScore = 0;
+        int maxScore = 0, maxLevel = 0, totalDeaths = 0;
+
+        for (const GameResult& result : results_) {
+            totalTicks += result.ticks;
+            totalScore += result.score;
+            totalDeaths += result.deaths;
+            maxScore = std::max(maxScore, result.score);
+            maxLevel = std::max(maxLevel, result.level);
+        }
+
+        double meanScore = results_.empty() ? 0.0 : static_cast<double>(totalScore) / static_cast<double>(results_.size());
+
+        file << "# games: " << gameCount_ << ", threads: " << threadCount_ << ", wall time: " << wallTime << " s, ticks: " << totalTicks << "\n"
+             << "# mean score: " << meanScore << ", max score: " << maxScore << ", max level: " << maxLevel << ", deaths: " << totalDeaths << "\n"
+             << "seed,score,level,deaths,ticks,wall_time_s,thread\n";
+
+        for (const GameResult& result : results_) {
+            file << result.seed << ',' << result.score << ',' << result.level << ',' << result.deaths << ','
+                 << result.ticks << ',' << result.wallTime << ',' << result.thread << '\n';
+        }
+
+        return static_cast<bool>(file);
+    }
+
+} // namespace pm
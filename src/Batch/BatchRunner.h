@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_BATCHRUNNER_H
+#define PACMAN_BATCHRUNNER_H
+
+#include "Core/Maze.h"
+#include "Core/LevelRules.h"
+#include "Core/InputScript.h"
+#include "Batch/WorkStealingQueue.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace pm {
+    /**
+     * @brief Plays many independent headless games on all CPU cores
+     *
+     * Game n is played with seed (first seed + n). Each worker thread
+     * starts with an equal share of the games in its own queue and steals
+     * from the other queues once its own runs dry, so a thread that drew
+     * short games does not sit idle while another one still has long
+     * games queued. The outcome of every game is written to a summary
+     * file, and the throughput of each thread is printed to the standard
+     * output
+     *
+     * Command line options:
+     *   --games <number>    The number of games to play (default: 1000)
+     *   --seed <number>     The seed of the first game (default: 0)
+     *   --threads <number>  The number of worker threads (default: one per core)
+     *   --ticks <number>    The maximum number of steps per game (default: one hour of game time)
+     *   --input <filename>  The input script every game plays (default: random key presses generated from each seed)
+     *   --output <filename> The summary file (default: batch_summary.csv)
+     *   --maze-dir <dir>    The directory that contains maze.txt, maze_attributes.txt and level_profiles.txt (default: res/TextFiles/)
+     *   --help, -h          Print the options and exit
+     */
+    class BatchRunner {
+    public:
+        /**
+         * @brief Constructor
+         */
+        BatchRunner();
+
+        /**
+         * @brief Initialize the batch from the command line
+         * @param argc The number of command line arguments
+         * @param argv The command line arguments
+         * @return True if the batch was initialized, or false if an option
+         *         is invalid, a file could not be loaded or the options
+         *         were printed instead (see isHelpRequested)
+         */
+        bool initialize(int argc, char* argv[]);
+
+        /**
+         * @brief Check if the command line asked for the options
+         * @return True if --help or -h was given, otherwise false
+         */
+        bool isHelpRequested() const;
+
+        /**
+         * @brief Play all games, then write the summary file and print
+         *        the throughput report
+         * @return True if the summary file was written, otherwise false
+         */
+        bool start();
+
+    private:
+        /**
+         * @brief Print the command line options to the standard output
+         */
+        static void printUsage();
+
+        /**
+         * @brief The outcome of a game
+         */
+        struct GameResult {
+            std::uint64_t seed = 0;  //!< The seed of the game
+            int score = 0;           //!< The final score
+            int level = 0;           //!< The level reached
+            int deaths = 0;          //!< The number of times pacman was caught
+            std::uint64_t ticks = 0; //!< The number of steps the game lasted
+            double wallTime = 0.0;   //!< The time (in seconds) it took to play the game
+            unsigned int thread = 0; //!< The worker thread that played the game
+        };
+
+        /**
+         * @brief The work done by a worker thread
+         *
+         * Each worker only writes its own entry, the alignment keeps the
+         * entries of different workers on different cache lines
+         */
+        struct alignas(64) WorkerStats {
+            unsigned int games = 0;  //!< The number of games played
+            unsigned int steals = 0; //!< The number of games taken from other workers
+            std::uint64_t ticks = 0; //!< The number of steps simulated
+            double busyTime = 0.0;   //!< The time (in seconds) spent playing games
+        };
+
+        /**
+         * @brief Play games until no worker has games left
+         * @param worker The index of the worker thread
+         */
+        void work(unsigned int worker);
+
+        /**
+         * @brief Play a game
+         * @param game The index of the game
+         * @param worker The index of the worker thread that plays the game
+         */
+        void playGame(unsigned int game, unsigned int worker);
+
+        /**
+         * @brief Write the outcome of all games to the summary file
+         * @param wallTime The time (in seconds) it took to play all games
+         * @return True if the file was written, otherwise false
+         */
+        bool saveSummary(double wallTime) const;
+
+    private:
+        std::uint64_t firstSeed_;   //!< The seed of the first game
+        unsigned int gameCount_;    //!< The number of games to play
+        unsigned int threadCount_;  //!< The number of worker threads
+        std::uint64_t maxTicks_;    //!< The maximum number of steps per game
+        std::string inputFile_;     //!< The input script every game plays, or an empty string for random key presses
+        std::string outputFile_;    //!< The summary file
+        std::string mazeDir_;       //!< The directory the maze and the level profiles are loaded from
+        bool isHelpRequested_;      //!< Flags whether or not the options were asked for
+        Maze maze_;                 //!< The maze the games are played in
+        LevelRules levelRules_;     //!< The speeds, durations and fruits of each level
+        InputScript input_;         //!< The input script loaded from inputFile_
+        std::vector<std::unique_ptr<WorkStealingQueue<unsigned int>>> queues_; //!< Games waiting to be played, one queue per worker
+        std::vector<GameResult> results_;   //!< The outcome of each game, indexed by game
+        std::vector<WorkerStats> workers_;  //!< The work done by each worker, indexed by worker
+    };
+}
+
+#endif //PACMAN_BATCHRUNNER_H
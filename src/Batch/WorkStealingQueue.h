@@ -0,0 +1,95 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_WORKSTEALINGQUEUE_H
+#define PACMAN_WORKSTEALINGQUEUE_H
+
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace pm {
+    /**
+     * @brief A queue of tasks owned by one worker thread that other
+     *        workers can steal from
+     *
+     * The owner pushes and pops tasks at the back of the queue, thieves
+     * take them from the front. Owner and thieves therefore work on
+     * opposite ends, which keeps a thief from taking the task the owner
+     * is about to run. Each batch task plays a whole game, so a lock per
+     * operation costs nothing measurable
+     */
+    template <typename Task>
+    class WorkStealingQueue {
+    public:
+        /**
+         * @brief Add a task
+         * @param task The task to be added
+         *
+         * Must only be called by the owner of the queue
+         */
+        void push(Task task) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+
+        /**
+         * @brief Take the most recently added task
+         * @return The task, or std::nullopt if the queue is empty
+         *
+         * Must only be called by the owner of the queue
+         */
+        std::optional<Task> pop() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (tasks_.empty())
+                return std::nullopt;
+
+            Task task = std::move(tasks_.back());
+            tasks_.pop_back();
+            return task;
+        }
+
+        /**
+         * @brief Take the least recently added task
+         * @return The task, or std::nullopt if the queue is empty
+         *
+         * May be called by any thread
+         */
+        std::optional<Task> steal() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (tasks_.empty())
+                return std::nullopt;
+
+            Task task = std::move(tasks_.front());
+            tasks_.pop_front();
+            return task;
+        }
+
+    private:
+        std::mutex mutex_;        //!< Serializes the owner and the thieves
+        std::deque<Task> tasks_;  //!< The queued tasks
+    };
+}
+
+#endif //PACMAN_WORKSTEALINGQUEUE_H
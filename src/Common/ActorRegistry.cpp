@@ -22,29 +22,48 @@
 // SOFTWARE.
 ////////////////////////////////////////////////////////////////////////////////
 
-#include "GIdleState.h"
-#include "ScatterState.h"
-#include "GameObjects/Ghost.h"
+#include "ActorRegistry.h"
 #include <cassert>
 
 namespace pm {
     ///////////////////////////////////////////////////////////////
-    GIdleState::GIdleState(ActorStateFSM* fsm, Ghost* ghost) :
-        GhostState(fsm, ghost)
-    {}
+    ActorHandle ActorRegistry::add(ime::GridObject* actor) {
+        assert(actor && "Cannot register a nullptr actor");
+
+        if (!freeSlots_.empty()) {
+            std::uint32_t index = freeSlots_.back();
+            freeSlots_.pop_back();
+            slots_[index].actor = actor;
+            return {index, slots_[index].generation};
+        }
+
+        assert(slots_.size() < ActorHandle::INVALID_INDEX && "Actor registry is full");
+        slots_.push_back({actor, 0});
+        return {static_cast<std::uint32_t>(slots_.size() - 1), 0};
+    }
 
     ///////////////////////////////////////////////////////////////
-    void GIdleState::onEntry() {
-        assert(ghost_->getGridMover() && "Cannot enter idle state without a grid mover");
-        ghost_->setState(static_cast<int>(Ghost::State::Idle));
-        ghost_->getGridMover()->setMovementRestriction(ime::GridMover::MoveRestriction::All);
+    void ActorRegistry::remove(ActorHandle handle) {
+        if (!contains(handle))
+            return;
+
+        Slot& slot = slots_[handle.index];
+        slot.actor = nullptr;
+        slot.generation += 1;
+        freeSlots_.push_back(handle.index);
     }
 
     ///////////////////////////////////////////////////////////////
-    void GIdleState::handleEvent(GameEvent event, const ime::PropertyContainer& args) {
-        if (event == GameEvent::ScatterModeBegin) {
-            ghost_->getGridMover()->setMovementRestriction(ime::GridMover::MoveRestriction::NonDiagonal);
-            fsm_->pop(std::make_unique<ScatterState>(fsm_, ghost_));
+    void ActorRegistry::clear() {
+        freeSlots_.clear();
+
+        for (std::uint32_t i = 0; i < slots_.size(); ++i) {
+            if (slots_[i].actor) {
+                slots_[i].actor = nullptr;
+                slots_[i].generation += 1;
+            }
+
+            freeSlots_.push_back(i);
         }
     }
 
@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_ACTORREGISTRY_H
+#define PACMAN_ACTORREGISTRY_H
+
+#include <cstdint>
+#include <vector>
+
+namespace ime {
+    class GridObject;
+}
+
+namespace pm {
+    /**
+     * @brief A reference to an actor registered with an ActorRegistry
+     *
+     * A handle stays small and cheap to copy. When the actor it refers
+     * to is removed from the registry, the handle becomes stale and
+     * resolving it yields a nullptr instead of a dangling pointer
+     */
+    struct ActorHandle {
+        static constexpr std::uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+        std::uint32_t index = INVALID_INDEX; //!< Slot of the actor in the registry
+        std::uint32_t generation = 0;        //!< Generation of the slot when the handle was issued
+    };
+
+    /**
+     * @brief Provides constant time access to the actors of a game session
+     *
+     * Each registered actor occupies a slot that is addressed by index. A
+     * slot is reused after its actor is removed, but its generation count
+     * is incremented so that handles issued for the previous occupant no
+     * longer resolve
+     */
+    class ActorRegistry {
+    public:
+        /**
+         * @brief Register an actor
+         * @param actor The actor to be registered
+         * @return A handle to the actor
+         *
+         * @warning @a actor must not be a nullptr
+         */
+        ActorHandle add(ime::GridObject* actor);
+
+        /**
+         * @brief Remove an actor from the registry
+         * @param handle The handle of the actor to be removed
+         *
+         * All handles to the actor become stale. This function has no
+         * effect if @a handle is already stale
+         */
+        void remove(ActorHandle handle);
+
+        /**
+         * @brief Get the actor a handle refers to
+         * @param handle The handle of the actor
+         * @return The actor if the handle is valid, otherwise a nullptr
+         */
+        ime::GridObject* get(ActorHandle handle) const {
+            if (handle.index >= slots_.size() || slots_[handle.index].generation != handle.generation)
+                return nullptr;
+
+            return slots_[handle.index].actor;
+        }
+
+        /**
+         * @brief Get the actor a handle refers to as a derived type
+         * @param handle The handle of the actor
+         * @return The actor if the handle is valid, otherwise a nullptr
+         *
+         * @warning The actor must be of type @a T
+         */
+        template <typename T>
+        T* get(ActorHandle handle) const {
+            return static_cast<T*>(get(handle));
+        }
+
+        /**
+         * @brief Check if a handle refers to a registered actor
+         * @param handle The handle to be checked
+         * @return True if the handle is valid, otherwise false
+         */
+        bool contains(ActorHandle handle) const {
+            return get(handle) != nullptr;
+        }
+
+        /**
+         * @brief Remove all actors from the registry
+         *
+         * All previously issued handles become stale
+         */
+        void clear();
+
+    private:
+        /**
+         * @brief Storage for a single actor
+         */
+        struct Slot {
+            ime::GridObject* actor;
+            std::uint32_t generation;
+        };
+
+        std::vector<Slot> slots_;               //!< Actor slots, indexed by handle
+        std::vector<std::uint32_t> freeSlots_;  //!< Indexes of slots that can be reused
+    };
+}
+
+#endif //PACMAN_ACTORREGISTRY_H
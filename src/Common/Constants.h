@@ -25,7 +25,7 @@
 #ifndef PACMAN_CONSTANTS_H
 #define PACMAN_CONSTANTS_H
 
-#include <IME/core/grid/Index.h>
+#include "Grid2D/MazeTypes.h"
 
 namespace pm {
     /**
@@ -36,17 +36,16 @@ namespace pm {
         static constexpr auto MAX_NUM_LEVEL_RESTARTS = 1;  //!< The number of times the player can restart a level before being forced to start from level 1
 
         // 2. Grid positions
-        static inline const auto FRUIT_SPAWN_POSITION = ime::Index{19, 16};      //!< The spawn position of a fruit when it appears
-        static inline const auto PACMAN_SPAWN_TILE = ime::Index{25, 16};         //!< Pacman's spawn position when a level starts or restarts
-        static inline const auto BLINKY_SPAWN_TILE = ime::Index{13, 16};         //!< Blinky's spawn position when a level starts or restarts
-        static inline const auto PINKY_SPAWN_TILE = ime::Index{16, 16};          //!< Pinky's spawn position when a level starts or restarts
-        static inline const auto INKY_SPAWN_TILE = ime::Index{16, 14};           //!< Inky's spawn position when a level starts or restarts
-        static inline const auto CLYDE_SPAWN_TILE = ime::Index{16, 18};          //!< Clyde's spawn position when a level starts or restarts
-        static inline const auto EATEN_GHOST_RESPAWN_TILE = ime::Index{17, 16};  //!< The tile a ghost targets after it is eaten (Once it reaches this tile, it gets revived)
-        static inline const auto PINKY_SCATTER_TARGET_TILE = ime::Index{0, 2};   //!< The tile the pink ghost targets when in scatter state
-        static inline const auto BLINKY_SCATTER_TARGET_TILE = ime::Index{0, 30}; //!< The tile the red ghost targets when in scatter state
-        static inline const auto INKY_SCATTER_TARGET_TILE = ime::Index{34, 30};  //!< The tile blue ghost targets when in scatter state
-        static inline const auto CLYDE_SCATTER_TARGET_TILE = ime::Index{34, 2};  //!< The tile the orange ghost targets when in scatter state
+        static constexpr auto PACMAN_SPAWN_TILE = TileIndex{25, 16};         //!< Pacman's spawn position when a level starts or restarts
+        static constexpr auto BLINKY_SPAWN_TILE = TileIndex{13, 16};         //!< Blinky's spawn position when a level starts or restarts
+        static constexpr auto PINKY_SPAWN_TILE = TileIndex{16, 16};          //!< Pinky's spawn position when a level starts or restarts
+        static constexpr auto INKY_SPAWN_TILE = TileIndex{16, 14};           //!< Inky's spawn position when a level starts or restarts
+        static constexpr auto CLYDE_SPAWN_TILE = TileIndex{16, 18};          //!< Clyde's spawn position when a level starts or restarts
+        static constexpr auto EATEN_GHOST_RESPAWN_TILE = TileIndex{17, 16};  //!< The tile a ghost targets after it is eaten (Once it reaches this tile, it gets revived)
+        static constexpr auto PINKY_SCATTER_TARGET_TILE = TileIndex{0, 2};   //!< The tile the pink ghost targets when in scatter state
+        static constexpr auto BLINKY_SCATTER_TARGET_TILE = TileIndex{0, 30}; //!< The tile the red ghost targets when in scatter state
+        static constexpr auto INKY_SCATTER_TARGET_TILE = TileIndex{34, 30};  //!< The tile blue ghost targets when in scatter state
+        static constexpr auto CLYDE_SCATTER_TARGET_TILE = TileIndex{34, 2};  //!< The tile the orange ghost targets when in scatter state
 
         // 3. Player
         static constexpr auto PLAYER_LiVES = 3;      // The initial number of player lives
@@ -28,6 +28,11 @@
 namespace pm {
     /**
      * @brief Events that take place during gameplay
+     *
+     * pm::Simulation notifies the ghosts of these events by calling
+     * their handler directly, the events carry no data and have no
+     * other subscribers. The gameplay scene does not listen to events,
+     * it compares consecutive game states instead
      */
     enum class GameEvent {
         FrightenedModeBegin, //!< Occurs when pacman eats an energizer pellet
@@ -36,8 +41,7 @@ namespace pm {
         ChaseModeEnd,        //!< Occurs when chase mode expires
         ScatterModeBegin,    //!< Occurs when chase mode expires
         ScatterModeEnd,      //!< Occurs when scatter mode expires
-        GhostEaten,          //!< Occurs when a ghost is eaten by pacman
-        LevelStarted,        //!< Fired when a level is started for the first time or when it is restarted
+        GhostEaten           //!< Occurs when a ghost is eaten by pacman
     };
 }
 
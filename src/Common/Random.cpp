@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Random.h"
+#include <cassert>
+
+namespace pm {
+    ///////////////////////////////////////////////////////////////
+    Random::Random(std::uint64_t seed, std::uint64_t stream) :
+        seed_{0},
+        state_{0},
+        increment_{1}
+    {
+        this->seed(seed, stream);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Random::seed(std::uint64_t seed, std::uint64_t stream) {
+        seed_ = seed;
+        state_ = 0;
+        increment_ = (stream << 1u) | 1u;
+        next();
+        state_ += seed;
+        next();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::uint64_t Random::getSeed() const {
+        return seed_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int Random::nextInt(int min, int max) {
+        assert(min <= max && "The minimum value of a random range must not be greater than the maximum value");
+
+        // Reject the top values that would make some numbers more likely than others
+        auto range = static_cast<std::uint32_t>(static_cast<std::int64_t>(max) - min) + 1u;
+        if (range == 0) // The range covers all 32-bit numbers
+            return static_cast<int>(next());
+
+        std::uint32_t threshold = (0u - range) % range;
+        std::uint32_t value = next();
+
+        while (value < threshold)
+            value = next();
+
+        return static_cast<int>(static_cast<std::int64_t>(min) + value % range);
+    }
+
+} // namespace pm
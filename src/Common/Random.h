@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_RANDOM_H
+#define PACMAN_RANDOM_H
+
+#include <cstdint>
+
+namespace pm {
+    /**
+     * @brief Small and fast pseudo random number generator (PCG32)
+     *
+     * All gameplay randomness goes through an instance of this class that is
+     * owned by the gameplay session. Since the generator is seeded explicitly,
+     * a game that is played with the same seed and the same input makes the
+     * same random decisions. This makes it possible to replay and benchmark
+     * the same game more than once
+     */
+    class Random {
+    public:
+        /**
+         * @brief Constructor
+         * @param seed The initial seed
+         * @param stream The sequence to generate numbers from
+         *
+         * Generators with the same seed but a different stream produce
+         * unrelated sequences
+         */
+        explicit Random(std::uint64_t seed = 0x853c49e6748fea9bULL, std::uint64_t stream = 0);
+
+        /**
+         * @brief Reseed the generator
+         * @param seed The new seed
+         * @param stream The sequence to generate numbers from
+         */
+        void seed(std::uint64_t seed, std::uint64_t stream = 0);
+
+        /**
+         * @brief Get the seed the generator was last seeded with
+         * @return The seed of the generator
+         */
+        std::uint64_t getSeed() const;
+
+        /**
+         * @brief Generate a uniformly distributed 32-bit number
+         * @return The generated number
+         */
+        std::uint32_t next() {
+            std::uint64_t oldState = state_;
+            state_ = oldState * 6364136223846793005ULL + increment_;
+            auto xorShifted = static_cast<std::uint32_t>(((oldState >> 18u) ^ oldState) >> 27u);
+            auto rotation = static_cast<std::uint32_t>(oldState >> 59u);
+            return (xorShifted >> rotation) | (xorShifted << ((-rotation) & 31u));
+        }
+
+        /**
+         * @brief Generate a number in a given range
+         * @param min The smallest number that can be generated
+         * @param max The largest number that can be generated
+         * @return A number in the range [min, max]
+         *
+         * @a min must not be greater than @a max
+         */
+        int nextInt(int min, int max);
+
+    private:
+        std::uint64_t seed_;      //!< The seed the generator was last seeded with
+        std::uint64_t state_;     //!< The current state of the generator
+        std::uint64_t increment_; //!< Selects the stream of the generator (always odd)
+    };
+}
+
+#endif //PACMAN_RANDOM_H
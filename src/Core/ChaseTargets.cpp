@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "ChaseTargets.h"
+#include "Common/Constants.h"
+
+namespace pm {
+    ///////////////////////////////////////////////////////////////
+    TileIndex chaseLikeBlinky(const ChaseContext& context) {
+        return context.pacmanTile;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    TileIndex chaseLikePinky(const ChaseContext& context) {
+        const TileIndex& pacmanTile = context.pacmanTile;
+        Dir pacmanDir = context.pacmanDirection;
+        auto targetTile = TileIndex{pacmanTile.row + 4 * rowOffset(pacmanDir), pacmanTile.colm + 4 * colmOffset(pacmanDir)};
+
+        // Mimic the overflow error
+        if (pacmanDir == Dir::Up)
+            targetTile.colm -= 4;
+
+        return targetTile;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    TileIndex chaseLikeInky(const ChaseContext& context) {
+        const TileIndex& pacmanTile = context.pacmanTile;
+        Dir pacmanDir = context.pacmanDirection;
+        const TileIndex& blinkyTile = context.blinkyTile;
+
+        // Choose a position two tiles in front of pacman
+        TileIndex pacmanTileOffset = TileIndex{pacmanTile.row + 2 * rowOffset(pacmanDir), pacmanTile.colm + 2 * colmOffset(pacmanDir)};
+
+        // Create a vector from chosen position to blinky's tile
+        TileIndex pacmanTileOffsetToBlinkyVector = TileIndex{-1 * (pacmanTileOffset.row - blinkyTile.row), -1 * (pacmanTileOffset.colm - blinkyTile.colm)};
+
+        // Flip vector 180 degrees
+        return TileIndex{pacmanTileOffset.row - pacmanTileOffsetToBlinkyVector.row, pacmanTileOffset.colm - pacmanTileOffsetToBlinkyVector.colm};
+    }
+
+    ///////////////////////////////////////////////////////////////
+    TileIndex chaseLikeClyde(const ChaseContext& context) {
+        const int CLYDE_SHYNESS_DISTANCE = 8; // Distance in tiles not pixels
+        int rowDistance = context.pacmanTile.row - context.ghostTile.row;
+        int colmDistance = context.pacmanTile.colm - context.ghostTile.colm;
+
+        if (rowDistance * rowDistance + colmDistance * colmDistance > CLYDE_SHYNESS_DISTANCE * CLYDE_SHYNESS_DISTANCE)
+            return context.pacmanTile;
+        else
+            return Constants::CLYDE_SCATTER_TARGET_TILE;
+    }
+
+} // namespace pm
@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_CHASETARGETS_H
+#define PACMAN_CHASETARGETS_H
+
+#include "Grid2D/MazeTypes.h"
+
+namespace pm {
+    /**
+     * @brief The positions a ghost needs to know about to find its chase target
+     */
+    struct ChaseContext {
+        TileIndex ghostTile;   //!< The tile the ghost is in
+        TileIndex pacmanTile;  //!< The tile pacman is in
+        Dir pacmanDirection;   //!< The direction pacman is moving in
+        TileIndex blinkyTile;  //!< The tile the red ghost is in
+    };
+
+    /**
+     * @brief Get the chase target of the red ghost
+     * @param context The positions of the actors
+     * @return Pacman's tile
+     */
+    TileIndex chaseLikeBlinky(const ChaseContext& context);
+
+    /**
+     * @brief Get the chase target of the pink ghost
+     * @param context The positions of the actors
+     * @return The tile four tiles in front of pacman
+     */
+    TileIndex chaseLikePinky(const ChaseContext& context);
+
+    /**
+     * @brief Get the chase target of the cyan ghost
+     * @param context The positions of the actors
+     * @return The tile two tiles in front of pacman, mirrored around blinky
+     */
+    TileIndex chaseLikeInky(const ChaseContext& context);
+
+    /**
+     * @brief Get the chase target of the orange ghost
+     * @param context The positions of the actors
+     * @return Pacman's tile when the ghost is far from him, otherwise the
+     *         ghost's scatter target tile
+     */
+    TileIndex chaseLikeClyde(const ChaseContext& context);
+}
+
+#endif //PACMAN_CHASETARGETS_H
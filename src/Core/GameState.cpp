@@ -0,0 +1,149 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "GameState.h"
+#include <cstring>
+
+namespace pm {
+    namespace {
+        /**
+         * @brief Accumulates a 32-bit FNV-1a hash
+         */
+        class Hasher {
+        public:
+            void add(std::uint32_t value) {
+                for (int i = 0; i < 4; i++) {
+                    hash_ ^= (value >> (i * 8)) & 0xFFu;
+                    hash_ *= 16777619u;
+                }
+            }
+
+            void add(std::uint64_t value) {
+                add(static_cast<std::uint32_t>(value));
+                add(static_cast<std::uint32_t>(value >> 32));
+            }
+
+            void add(int value) {
+                add(static_cast<std::uint32_t>(value));
+            }
+
+            void add(bool value) {
+                add(static_cast<std::uint32_t>(value));
+            }
+
+            void add(float value) {
+                std::uint32_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                add(bits);
+            }
+
+            template <typename Enum, typename = std::enable_if_t<std::is_enum_v<Enum>>>
+            void add(Enum value) {
+                add(static_cast<std::uint32_t>(value));
+            }
+
+            void add(const TileIndex& tile) {
+                add(tile.row);
+                add(tile.colm);
+            }
+
+            void add(const TimerWheel& timers) {
+                add(timers.getTick());
+
+                for (int id = 0; id < GameTimerCount; id++) {
+                    add(timers.isRunning(id));
+                    add(timers.isPaused(id));
+                    add(timers.getRemaining(id));
+                }
+            }
+
+            void add(const MoverState& mover) {
+                add(mover.tile);
+                add(mover.direction);
+                add(mover.moveDir);
+                add(mover.isFrozen);
+                add(mover.distance);
+            }
+
+            std::uint32_t get() const {
+                return hash_;
+            }
+
+        private:
+            std::uint32_t hash_ = 2166136261u;
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::uint32_t computeStateHash(const GameState& state) {
+        // Fields are hashed one by one, the padding between them is not
+        // guaranteed to have the same value in two equal states
+        Hasher hasher;
+        hasher.add(state.seed);
+        hasher.add(state.tick);
+        hasher.add(state.phase);
+        hasher.add(state.isBoot);
+        hasher.add(state.level);
+        hasher.add(state.score);
+        hasher.add(state.extraLivesGiven);
+        hasher.add(state.deaths);
+        hasher.add(state.eatenPelletCount);
+        hasher.add(state.remainingPelletCount);
+        hasher.add(state.pointsMultiplier);
+        hasher.add(state.scatterWave);
+        hasher.add(state.chaseWave);
+        hasher.add(state.ghostsInHouse);
+
+        // The generator does not expose its state, its next number stands in for it
+        Random random = state.random;
+        hasher.add(random.next());
+
+        hasher.add(state.pacman.mover);
+        hasher.add(state.pacman.pendingDir);
+        hasher.add(state.pacman.mode);
+        hasher.add(state.pacman.lives);
+
+        for (const GhostActor& ghost : state.ghosts) {
+            hasher.add(ghost.mover);
+            hasher.add(ghost.mode);
+            hasher.add(ghost.nextMode);
+            hasher.add(ghost.strategy);
+            hasher.add(ghost.isLocked);
+            hasher.add(ghost.isInTunnel);
+            hasher.add(ghost.isMovementStarted);
+            hasher.add(ghost.hasChaseTarget);
+            hasher.add(ghost.targetTile);
+        }
+
+        hasher.add(state.fruit.isActive);
+        hasher.add(state.fruit.type);
+        hasher.add(state.timers);
+
+        for (std::uint64_t bits : state.pellets)
+            hasher.add(bits);
+
+        return hasher.get();
+    }
+
+} // namespace pm
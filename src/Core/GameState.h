@@ -0,0 +1,239 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_GAMESTATE_H
+#define PACMAN_GAMESTATE_H
+
+#include "Grid2D/MazeTypes.h"
+#include "Common/Random.h"
+#include "Core/TimerWheel.h"
+#include <cstdint>
+#include <type_traits>
+
+namespace pm {
+    /**
+     * @brief The phases a level goes through
+     */
+    enum class GamePhase : std::uint8_t {
+        Countdown,     //!< Actors wait for the level to start
+        Playing,       //!< The player is in control of pacman
+        PacManDying,   //!< Pacman is playing his death animation
+        LevelComplete, //!< All pellets were eaten and the grid is flashing
+        GameOver       //!< The player has no lives left
+    };
+
+    /**
+     * @brief The states pacman can be in (see pm::PacMan::State)
+     */
+    enum class PacManMode : std::uint8_t {
+        Idle,   //!< Pacman cannot move
+        Moving, //!< Pacman moves until he hits a wall
+        Dying   //!< Pacman was caught by a ghost
+    };
+
+    /**
+     * @brief The states a ghost can be in (see pm::Ghost::State)
+     */
+    enum class GhostMode : std::uint8_t {
+        Idle,       //!< The ghost waits for scatter mode to begin
+        Scatter,    //!< The ghost targets its home corner
+        Chase,      //!< The ghost targets a tile around pacman
+        Frightened, //!< The ghost wanders randomly and can be eaten
+        Eaten       //!< The ghost returns to the ghost house
+    };
+
+    /**
+     * @brief How a ghost chooses between multiple directions at a junction
+     *
+     * Frightened ghosts move randomly, the level profile decides how the
+     * other ghosts measure the distance to their target tile (see
+     * pm::LevelRules::getGhostTargetStrategy)
+     */
+    enum class MoveStrategy : std::uint8_t {
+        Random,      //!< Choose a random direction
+        Target,      //!< Choose the direction closest to the target tile in a straight line
+        PathDistance //!< Choose the direction closest to the target tile along the maze
+    };
+
+    /**
+     * @brief The types of fruits (see pm::Fruit::Type)
+     */
+    enum class FruitType : std::uint8_t {
+        Cherry,     //!< Cherry
+        Strawberry, //!< Strawberry
+        Peach,      //!< Peach
+        Apple,      //!< Apple
+        Melon,      //!< Melon
+        Galaxian,   //!< Galaxian
+        Bell,       //!< Bell
+        Key         //!< Key
+    };
+
+    /**
+     * @brief Identifies a ghost in pm::GameState::ghosts
+     */
+    enum GhostId : std::uint8_t {
+        Blinky,    //!< The red ghost
+        Pinky,     //!< The pink ghost
+        Inky,      //!< The cyan ghost
+        Clyde,     //!< The orange ghost
+        GhostCount //!< The number of ghosts
+    };
+
+    /**
+     * @brief The timers of a game, as ids in pm::GameState::timers
+     *
+     * Timers that expire in the same step are handled in this order
+     */
+    enum GameTimer : std::uint8_t {
+        GhostHouseTimer,                           //!< Controls when a ghost leaves the ghost house
+        ChaseModeTimer,                            //!< Controls the duration of the ghosts chase state
+        ScatterModeTimer,                          //!< Controls the duration of the ghosts scatter state
+        FrightenedModeTimer,                       //!< Controls the duration of the ghosts frightened state
+        UneatenFruitTimer,                         //!< Controls how long an uneaten fruit remains in the maze
+        EatenDelayTimer,                           //!< Delay between a ghost being caught by pacman and being eaten, one per pm::GhostId
+        PhaseTimer = EatenDelayTimer + GhostCount, //!< Time left before the current phase ends
+        GameTimerCount                             //!< The number of timers
+    };
+
+    static_assert(GameTimerCount <= TimerWheel::CAPACITY, "pm::TimerWheel cannot hold every pm::GameTimer");
+
+    /**
+     * @brief The state of an actor that moves from tile to tile
+     *        (see ime::GridMover)
+     */
+    struct MoverState {
+        TileIndex tile;            //!< The tile the actor occupies
+        Dir direction = Dir::None; //!< The direction the actor is facing
+        Dir moveDir = Dir::None;   //!< The direction the actor is moving in, or Dir::None if it is not moving
+        bool isFrozen = false;     //!< A frozen actor does not advance towards its target tile
+        float distance = 0.0f;     //!< The distance (in pixels) covered towards the target tile
+    };
+
+    /**
+     * @brief The state of pacman
+     */
+    struct PacManActor {
+        MoverState mover;                   //!< Pacman's movement
+        Dir pendingDir = Dir::None;         //!< The direction to turn to as soon as it is open
+        PacManMode mode = PacManMode::Idle; //!< Pacman's current state
+        int lives = 0;                      //!< The number of lives the player has left
+    };
+
+    /**
+     * @brief The state of a ghost
+     */
+    struct GhostActor {
+        MoverState mover;                             //!< The ghost's movement
+        GhostMode mode = GhostMode::Idle;             //!< The ghost's current state
+        GhostMode nextMode = GhostMode::Idle;         //!< The state to return to after being frightened or eaten
+        MoveStrategy strategy = MoveStrategy::Random; //!< How the ghost chooses its direction at junctions
+        bool isLocked = false;                        //!< Flags whether or not the ghost is locked in the ghost house
+        bool isInTunnel = false;                      //!< Flags whether or not the ghost is slowed down by a tunnel
+        bool isMovementStarted = false;               //!< Flags whether or not the ghost started moving since it was placed on its spawn tile
+        bool hasChaseTarget = false;                  //!< Flags whether or not the target tile follows pacman
+        TileIndex targetTile;                         //!< The tile the ghost moves towards
+    };
+
+    /**
+     * @brief The state of the bonus fruit
+     */
+    struct FruitState {
+        bool isActive = false;              //!< Flags whether or not a fruit is in the maze
+        FruitType type = FruitType::Cherry; //!< The type of the fruit in the maze
+    };
+
+    /**
+     * @brief Everything that changes while a game is played
+     *
+     * The state is plain data without pointers, so it can be copied
+     * freely. Everything that does not change during a game is held
+     * by pm::Maze instead
+     */
+    struct GameState {
+        static constexpr int MAX_TILE_COUNT = 4096; //!< The maximum number of tiles in a maze
+
+        std::uint64_t seed = 0;                          //!< The seed of the game
+        std::uint64_t tick = 0;                          //!< The number of steps the game was advanced by
+        GamePhase phase = GamePhase::Countdown;          //!< The current phase of the level
+        bool isBoot = true;                              //!< Flags whether or not the first countdown of the game is running
+        int level = 1;                                   //!< The current level
+        int score = 0;                                   //!< The player's score
+        int extraLivesGiven = 0;                         //!< The number of extra lives the player was awarded with
+        int deaths = 0;                                  //!< The number of times pacman was caught
+        int eatenPelletCount = 0;                        //!< The number of pellets eaten in the current level
+        int remainingPelletCount = 0;                    //!< The number of pellets left in the current level
+        int pointsMultiplier = 1;                        //!< Ghost points multiplier when pacman eats ghosts in succession
+        unsigned int scatterWave = 0;                    //!< The current scatter mode wave
+        unsigned int chaseWave = 0;                      //!< The current chase mode wave
+        unsigned int ghostsInHouse = 0;                  //!< The number of ghosts locked in the ghost house
+        Random random;                                   //!< Source of all gameplay randomness, seeded from the seed and the level
+        PacManActor pacman;                              //!< Pacman
+        GhostActor ghosts[GhostCount];                   //!< The ghosts, indexed by pm::GhostId
+        FruitState fruit;                                //!< The bonus fruit
+        TimerWheel timers;                               //!< The timers of the game, indexed by pm::GameTimer
+        std::uint64_t pellets[MAX_TILE_COUNT / 64] = {}; //!< One bit per tile id, set if the tile holds an uneaten pellet
+
+        /**
+         * @brief Check if a tile holds an uneaten pellet
+         * @param tileId The id of the tile (see pm::Maze::toTileId)
+         * @return True if the tile holds a pellet, otherwise false
+         */
+        bool hasPellet(int tileId) const {
+            return (pellets[tileId >> 6] >> (tileId & 63)) & 1u;
+        }
+
+        /**
+         * @brief Place a pellet on a tile
+         * @param tileId The id of the tile (see pm::Maze::toTileId)
+         */
+        void addPellet(int tileId) {
+            pellets[tileId >> 6] |= std::uint64_t{1} << (tileId & 63);
+        }
+
+        /**
+         * @brief Remove the pellet from a tile
+         * @param tileId The id of the tile (see pm::Maze::toTileId)
+         */
+        void removePellet(int tileId) {
+            pellets[tileId >> 6] &= ~(std::uint64_t{1} << (tileId & 63));
+        }
+    };
+
+    // Snapshots, batch runs and search copy game states around, which
+    // must never need more than a memcpy
+    static_assert(std::is_trivially_copyable_v<GameState>, "pm::GameState must remain trivially copyable");
+
+    /**
+     * @brief Compute a hash of a game state
+     * @param state The state to be hashed
+     * @return The hash of the state
+     *
+     * Equal states always have the same hash, so two runs of a game can
+     * be compared by their hashes instead of their complete states
+     */
+    std::uint32_t computeStateHash(const GameState& state);
+}
+
+#endif //PACMAN_GAMESTATE_H
@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "InputScript.h"
+#include "Common/Random.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace pm {
+    ///////////////////////////////////////////////////////////////
+    bool InputScript::loadFromFile(const std::string& filename) {
+        std::ifstream file(filename);
+        if (!file)
+            return false;
+
+        events_.clear();
+        std::string line;
+
+        while (std::getline(file, line)) {
+            if (line.empty() || line[0] == '#')
+                continue;
+
+            std::istringstream stream(line);
+            InputEvent event;
+            char key;
+
+            if (!(stream >> event.tick >> key))
+                return false;
+
+            switch (key) {
+                case 'U': event.dir = Dir::Up; break;
+                case 'D': event.dir = Dir::Down; break;
+                case 'L': event.dir = Dir::Left; break;
+                case 'R': event.dir = Dir::Right; break;
+                default:
+                    return false;
+            }
+
+            events_.push_back(event);
+        }
+
+        std::stable_sort(events_.begin(), events_.end(), [](const InputEvent& lhs, const InputEvent& rhs) {
+            return lhs.tick < rhs.tick;
+        });
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void InputScript::generate(std::uint64_t seed, std::uint64_t tickCount) {
+        const int MIN_PRESS_INTERVAL = 12; // Steps between two key presses
+        const int MAX_PRESS_INTERVAL = 60;
+
+        // Gameplay randomness uses the level as stream, so the key presses
+        // never repeat the choices the ghosts make
+        Random random{seed, 0};
+        events_.clear();
+
+        for (std::uint64_t tick = static_cast<std::uint64_t>(random.nextInt(MIN_PRESS_INTERVAL, MAX_PRESS_INTERVAL));
+             tick < tickCount; tick += static_cast<std::uint64_t>(random.nextInt(MIN_PRESS_INTERVAL, MAX_PRESS_INTERVAL)))
+        {
+            events_.push_back(InputEvent{tick, static_cast<Dir>(random.nextInt(0, 3))});
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const std::vector<InputEvent>& InputScript::getEvents() const {
+        return events_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void InputScript::play(const Simulation& simulation, GameState& state, std::uint64_t maxTicks) const {
+        // Skip the key presses of steps that were already made
+        auto nextEvent = std::lower_bound(events_.begin(), events_.end(), state.tick, [](const InputEvent& event, std::uint64_t tick) {
+            return event.tick < tick;
+        });
+
+        while (state.phase != GamePhase::GameOver && state.tick < maxTicks) {
+            Dir input = Dir::None;
+
+            // Only the last of several key presses in the same step takes effect
+            while (nextEvent != events_.end() && nextEvent->tick <= state.tick)
+                input = (nextEvent++)->dir;
+
+            simulation.step(state, input);
+        }
+    }
+
+} // namespace pm
@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_INPUTSCRIPT_H
+#define PACMAN_INPUTSCRIPT_H
+
+#include "Core/Simulation.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace pm {
+    /**
+     * @brief A direction pressed by the player at a given simulation step
+     */
+    struct InputEvent {
+        std::uint64_t tick = 0; //!< The step in which the direction is pressed
+        Dir dir = Dir::None;    //!< The pressed direction
+    };
+
+    /**
+     * @brief Plays the part of the player in a game without a window
+     *
+     * A script is either loaded from a text file or generated from a seed.
+     * The file lists one key press per line as the step followed by the
+     * direction (U, D, L or R), for example "240 L". Empty lines and lines
+     * starting with '#' are ignored
+     */
+    class InputScript {
+    public:
+        /**
+         * @brief Load the script from a file
+         * @param filename The name of the file that contains the script
+         * @return True if the script was loaded, or false if the file could
+         *         not be read or contains an invalid line
+         */
+        bool loadFromFile(const std::string& filename);
+
+        /**
+         * @brief Generate a script that presses random directions
+         * @param seed The seed of the generated key presses
+         * @param tickCount The number of steps to generate key presses for
+         *
+         * A new direction is pressed every few tenths of a second, which is
+         * roughly how often a human player turns pacman
+         */
+        void generate(std::uint64_t seed, std::uint64_t tickCount);
+
+        /**
+         * @brief Get the key presses of the script
+         * @return The key presses, ordered by step
+         */
+        const std::vector<InputEvent>& getEvents() const;
+
+        /**
+         * @brief Play a game with the key presses of the script
+         * @param simulation The simulation that advances the game
+         * @param state The state of the game, as reset by @a simulation
+         * @param maxTicks The maximum number of steps to advance the game by
+         *
+         * The game is advanced at pm::Simulation::TIMESTEP until it is
+         * over or @a maxTicks steps were made. Key presses are matched
+         * to steps by pm::GameState::tick
+         */
+        void play(const Simulation& simulation, GameState& state, std::uint64_t maxTicks) const;
+
+    private:
+        std::vector<InputEvent> events_; //!< Key presses ordered by step
+    };
+}
+
+#endif //PACMAN_INPUTSCRIPT_H
@@ -0,0 +1,221 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "LevelRules.h"
+#include "Common/Constants.h"
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+namespace pm {
+    namespace {
+        /**
+         * @brief A row of the level profiles file
+         *
+         * Speeds are multiples of the base speed of pacman
+         */
+        struct ProfileRow {
+            float pacmanSpeed;                                              //!< The speed of pacman
+            float ghostSpeed;                                               //!< The speed of idle, scattering and chasing ghosts
+            float tunnelSpeed;                                              //!< The speed of a ghost in a tunnel
+            float frightenedSpeed;                                          //!< The speed of a frightened ghost
+            float eatenSpeed;                                               //!< The speed of an eaten ghost
+            float frightenedModeDuration;                                   //!< The duration of frightened mode in seconds
+            float scatterModeDurations[LevelProfile::SCATTER_WAVE_COUNT];   //!< The duration of each scatter wave in seconds
+            float chaseModeDurations[LevelProfile::CHASE_WAVE_COUNT];       //!< The duration of each chase wave in seconds
+            FruitType fruitType;                                            //!< The bonus fruit of the level
+            MoveStrategy ghostTargetStrategy;                               //!< How ghosts measure the distance to their target tile
+        };
+
+        ///////////////////////////////////////////////////////////////
+        LevelProfile createProfile(const ProfileRow& row) {
+            LevelProfile profile{};
+            profile.pacmanSpeed = row.pacmanSpeed * Constants::PACMAN_SPEED;
+
+            // Frightened and eaten ghosts are not slowed down by tunnels
+            for (int isInTunnel = 0; isInTunnel < 2; ++isInTunnel) {
+                float* speeds = profile.ghostSpeeds[isInTunnel];
+                float speed = (isInTunnel ? row.tunnelSpeed : row.ghostSpeed) * Constants::PACMAN_SPEED;
+                speeds[static_cast<int>(GhostMode::Idle)] = speed;
+                speeds[static_cast<int>(GhostMode::Scatter)] = speed;
+                speeds[static_cast<int>(GhostMode::Chase)] = speed;
+                speeds[static_cast<int>(GhostMode::Frightened)] = row.frightenedSpeed * Constants::PACMAN_SPEED;
+                speeds[static_cast<int>(GhostMode::Eaten)] = row.eatenSpeed * Constants::PACMAN_SPEED;
+            }
+
+            profile.frightenedModeDuration = row.frightenedModeDuration;
+            std::copy(std::begin(row.scatterModeDurations), std::end(row.scatterModeDurations), profile.scatterModeDurations);
+            std::copy(std::begin(row.chaseModeDurations), std::end(row.chaseModeDurations), profile.chaseModeDurations);
+            profile.fruitType = row.fruitType;
+            profile.ghostTargetStrategy = row.ghostTargetStrategy;
+
+            return profile;
+        }
+
+        ///////////////////////////////////////////////////////////////
+        bool parseFruitType(const std::string& name, FruitType& type) {
+            static const char* const NAMES[] = {"Cherry", "Strawberry", "Peach", "Apple", "Melon", "Galaxian", "Bell", "Key"};
+
+            for (std::size_t i = 0; i < std::size(NAMES); ++i) {
+                if (name == NAMES[i]) {
+                    type = static_cast<FruitType>(i);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        ///////////////////////////////////////////////////////////////
+        bool parseTargetStrategy(const std::string& name, MoveStrategy& strategy) {
+            if (name == "Straight")
+                strategy = MoveStrategy::Target;
+            else if (name == "Path")
+                strategy = MoveStrategy::PathDistance;
+            else
+                return false;
+
+            return true;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool LevelRules::loadFromFile(const std::string& filename) {
+        std::ifstream file(filename);
+        if (!file)
+            return false;
+
+        return loadFromStream(file);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool LevelRules::loadFromStream(std::istream& stream) {
+        std::vector<LevelProfile> profiles;
+        std::string line;
+
+        while (std::getline(stream, line)) {
+            if (line.empty() || line[0] == '#' || line.find_first_not_of(" \t\r") == std::string::npos)
+                continue;
+
+            std::istringstream columns(line);
+            ProfileRow row{};
+            int level;
+            std::string fruit, distance;
+
+            columns >> level >> row.pacmanSpeed >> row.ghostSpeed >> row.tunnelSpeed >> row.frightenedSpeed
+                    >> row.eatenSpeed >> row.frightenedModeDuration;
+
+            for (float& duration : row.scatterModeDurations)
+                columns >> duration;
+
+            for (float& duration : row.chaseModeDurations)
+                columns >> duration;
+
+            // Levels must be listed in order without gaps
+            if (!(columns >> fruit >> distance) || level != static_cast<int>(profiles.size()) + 1
+                || !parseFruitType(fruit, row.fruitType) || !parseTargetStrategy(distance, row.ghostTargetStrategy))
+            {
+                return false;
+            }
+
+            profiles.push_back(createProfile(row));
+        }
+
+        if (profiles.empty())
+            return false;
+
+        profiles_ = std::move(profiles);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const LevelProfile& LevelRules::getProfile(int level) const {
+        assert(!profiles_.empty() && "The level profiles must be loaded before they are read");
+        return profiles_[static_cast<std::size_t>(std::clamp(level, 1, static_cast<int>(profiles_.size())) - 1)];
+    }
+
+    ///////////////////////////////////////////////////////////////
+    float LevelRules::getPacManSpeed(int level) const {
+        return getProfile(level).pacmanSpeed;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    float LevelRules::getGhostSpeed(int level, GhostMode mode, bool isInTunnel) const {
+        return getProfile(level).ghostSpeeds[isInTunnel][static_cast<int>(mode)];
+    }
+
+    ///////////////////////////////////////////////////////////////
+    float LevelRules::getFrightenedModeDuration(int level) const {
+        return getProfile(level).frightenedModeDuration;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    float LevelRules::getScatterModeDuration(int level, unsigned int wave) const {
+        return getProfile(level).scatterModeDurations[std::clamp(wave, 1u, LevelProfile::SCATTER_WAVE_COUNT) - 1];
+    }
+
+    ///////////////////////////////////////////////////////////////
+    float LevelRules::getChaseModeDuration(int level, unsigned int wave) const {
+        return getProfile(level).chaseModeDurations[std::clamp(wave, 1u, LevelProfile::CHASE_WAVE_COUNT) - 1];
+    }
+
+    ///////////////////////////////////////////////////////////////
+    FruitType LevelRules::getFruitType(int level) const {
+        return getProfile(level).fruitType;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    MoveStrategy LevelRules::getGhostTargetStrategy(int level) const {
+        return getProfile(level).ghostTargetStrategy;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int LevelRules::getFruitPoints(FruitType type) {
+        switch (type) {
+            case FruitType::Cherry:
+                return Constants::Points::CHERRY;
+            case FruitType::Strawberry:
+                return Constants::Points::STRAWBERRY;
+            case FruitType::Peach:
+                return Constants::Points::PEACH;
+            case FruitType::Apple:
+                return Constants::Points::APPLE;
+            case FruitType::Melon:
+                return Constants::Points::MELON;
+            case FruitType::Galaxian:
+                return Constants::Points::GALAXIAN;
+            case FruitType::Bell:
+                return Constants::Points::BELL;
+            case FruitType::Key:
+                return Constants::Points::KEY;
+        }
+
+        return 0;
+    }
+
+} // namespace pm
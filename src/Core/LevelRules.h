@@ -0,0 +1,172 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_LEVELRULES_H
+#define PACMAN_LEVELRULES_H
+
+#include "Core/GameState.h"
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace pm {
+    /**
+     * @brief The speeds, durations and bonus fruit of a single level
+     */
+    struct LevelProfile {
+        static constexpr unsigned int GHOST_MODE_COUNT = 5;   //!< The number of pm::GhostMode values
+        static constexpr unsigned int SCATTER_WAVE_COUNT = 4; //!< The number of scatter waves with their own duration
+        static constexpr unsigned int CHASE_WAVE_COUNT = 5;   //!< The number of chase waves with their own duration
+
+        float pacmanSpeed;                                  //!< The speed of pacman in pixels per second
+        float ghostSpeeds[2][GHOST_MODE_COUNT];             //!< The speed of a ghost in pixels per second, indexed by [isInTunnel][GhostMode]
+        float frightenedModeDuration;                       //!< The duration of the ghost frightened mode in seconds
+        float scatterModeDurations[SCATTER_WAVE_COUNT];     //!< The duration of each scatter wave in seconds (the last one applies to later waves)
+        float chaseModeDurations[CHASE_WAVE_COUNT];         //!< The duration of each chase wave in seconds (the last one applies to later waves)
+        FruitType fruitType;                                //!< The type of the bonus fruit
+        MoveStrategy ghostTargetStrategy;                   //!< How ghosts measure the distance to their target tile, MoveStrategy::Target or MoveStrategy::PathDistance
+    };
+
+    /**
+     * @brief Speeds, durations and rewards that depend on the current level
+     *
+     * The rules are kept in a flat table of level profiles that is
+     * loaded from a file with pm::LevelRules::loadFromFile, the game ships
+     * its profiles in res/TextFiles/level_profiles.txt. A simulation only
+     * reads the rules it was constructed with, so games with different
+     * rules can be played side by side in one process. Levels beyond the
+     * last profile use the last profile
+     *
+     * @warning The rules have no profiles until they are loaded, they
+     * must not be read before pm::LevelRules::loadFromFile succeeds
+     */
+    class LevelRules {
+    public:
+        /**
+         * @brief Replace the level profiles with those in a file
+         * @param filename The name of the file to load the profiles from
+         * @return True if the profiles were loaded, or false if the file
+         *         could not be opened or is malformed
+         *
+         * The file has one row per level, starting at level 1 (see
+         * res/TextFiles/level_profiles.txt for the columns). On failure
+         * the current profiles are left unchanged.
+         *
+         * @warning The profiles are not synchronized, they must not be
+         * loaded while a simulation that uses them advances a game
+         */
+        bool loadFromFile(const std::string& filename);
+
+        /**
+         * @brief Replace the level profiles with those read from a stream
+         * @param stream The stream to read the profiles from
+         * @return True if the profiles were loaded, or false if the
+         *         stream is malformed
+         *
+         * The stream has the same format as a level profiles file
+         * (see loadFromFile)
+         */
+        bool loadFromStream(std::istream& stream);
+
+        /**
+         * @brief Get the profile of a level
+         * @param level The level to get the profile of (starting at 1)
+         * @return The profile of the level
+         */
+        const LevelProfile& getProfile(int level) const;
+
+        /**
+         * @brief Get the speed of pacman
+         * @param level The current level
+         * @return The speed of pacman in pixels per second
+         */
+        float getPacManSpeed(int level) const;
+
+        /**
+         * @brief Get the speed of a ghost
+         * @param level The current level
+         * @param mode The current state of the ghost
+         * @param isInTunnel True if the ghost is in a tunnel, otherwise false
+         * @return The speed of the ghost in pixels per second
+         */
+        float getGhostSpeed(int level, GhostMode mode, bool isInTunnel) const;
+
+        /**
+         * @brief Get the duration of the ghost frightened mode
+         * @param level The current level
+         * @return The time (in seconds) the ghosts remain frightened after
+         *         pacman eats an energizer
+         */
+        float getFrightenedModeDuration(int level) const;
+
+        /**
+         * @brief Get the duration of a ghost scatter mode wave
+         * @param level The current level
+         * @param wave The scatter mode wave (starting at 1)
+         * @return The time (in seconds) the ghosts remain in scatter mode
+         */
+        float getScatterModeDuration(int level, unsigned int wave) const;
+
+        /**
+         * @brief Get the duration of a ghost chase mode wave
+         * @param level The current level
+         * @param wave The chase mode wave (starting at 1)
+         * @return The time (in seconds) the ghosts remain in chase mode
+         *
+         * From the fourth wave onwards the ghosts remain in chase mode
+         * indefinitely, the returned duration is only long enough never
+         * to expire
+         */
+        float getChaseModeDuration(int level, unsigned int wave) const;
+
+        /**
+         * @brief Get the type of fruit that appears in a level
+         * @param level The current level
+         * @return The type of the bonus fruit
+         */
+        FruitType getFruitType(int level) const;
+
+        /**
+         * @brief Get how the ghosts choose between directions that lead
+         *        to their target tile
+         * @param level The current level
+         * @return MoveStrategy::Target if the ghosts compare straight line
+         *         distances or MoveStrategy::PathDistance if they compare
+         *         distances along the maze
+         */
+        MoveStrategy getGhostTargetStrategy(int level) const;
+
+        /**
+         * @brief Get the points awarded for eating a fruit
+         * @param type The type of the fruit
+         * @return The points awarded to the player
+         */
+        static int getFruitPoints(FruitType type);
+
+    private:
+        std::vector<LevelProfile> profiles_; //!< The level profiles, indexed by level - 1
+    };
+}
+
+#endif //PACMAN_LEVELRULES_H
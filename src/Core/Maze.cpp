@@ -0,0 +1,180 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Maze.h"
+#include "Core/GameState.h"
+#include "Common/Constants.h"
+#include <cassert>
+
+namespace pm {
+    namespace {
+        /**
+         * @brief Check the size of a layout
+         * @param layout The layout to be checked
+         * @param rowCount The number of rows the layout must have
+         * @param colmCount The number of columns each row must have
+         * @return True if the layout has the given size, otherwise false
+         */
+        bool hasSize(const MazeLayout& layout, std::size_t rowCount, std::size_t colmCount) {
+            if (layout.size() != rowCount)
+                return false;
+
+            for (const std::string& row : layout) {
+                if (row.size() != colmCount)
+                    return false;
+            }
+
+            return true;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    Maze::Maze() :
+        rowCount_{0},
+        colmCount_{0},
+        pelletCount_{0}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    bool Maze::loadFromFile(const std::string& filename, const std::string& attributesFilename) {
+        MazeLayout layout = loadMazeLayout(filename);
+        MazeLayout attributes = loadMazeLayout(attributesFilename);
+
+        if (layout.empty() || attributes.empty())
+            return false;
+
+        // The files are checked here, create() only asserts its preconditions
+        std::size_t rowCount = layout.size(), colmCount = layout.front().size();
+        if (rowCount * colmCount > static_cast<std::size_t>(GameState::MAX_TILE_COUNT)
+            || !hasSize(layout, rowCount, colmCount) || !hasSize(attributes, rowCount, colmCount))
+        {
+            return false;
+        }
+
+        TileAttributes tileAttributes;
+        tileAttributes.create(attributes);
+
+        int row, colm;
+        if (!tileAttributes.findFirst(TileFlag::FruitSpawn, row, colm))
+            return false;
+
+        create(layout, attributes);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Maze::create(const MazeLayout& layout, const MazeLayout& attributes) {
+        navTable_.create(layout);
+        rowCount_ = navTable_.getRowCount();
+        colmCount_ = navTable_.getColumnCount();
+        assert(rowCount_ * colmCount_ <= GameState::MAX_TILE_COUNT && "The maze has more tiles than a game state can track");
+
+        distanceTable_.create(navTable_);
+        junctionGraph_.create(navTable_);
+        tileAttributes_.create(attributes);
+        assert(tileAttributes_.contains(rowCount_ - 1, colmCount_ - 1) && "The tile attributes must have the same size as the maze");
+
+        const TileIndex& respawnTile = Constants::EATEN_GHOST_RESPAWN_TILE;
+        respawnFlowField_.create(navTable_, distanceTable_, respawnTile.row, respawnTile.colm);
+
+        [[maybe_unused]] bool hasFruitSpawnTile = tileAttributes_.findFirst(TileFlag::FruitSpawn, fruitSpawnTile_.row, fruitSpawnTile_.colm);
+        assert(hasFruitSpawnTile && "The maze does not have a fruit spawn tile");
+
+        // The ids are the same as the ones pm::ObjectCreator creates game objects from
+        pelletCount_ = 0;
+        contents_.assign(static_cast<std::size_t>(rowCount_ * colmCount_), 0);
+
+        for (int row = 0; row < rowCount_; row++) {
+            for (int colm = 0; colm < colmCount_; colm++) {
+                std::uint8_t& contents = contents_[static_cast<std::size_t>(toTileId(row, colm))];
+
+                switch (layout[row][colm]) {
+                    case 'D':
+                        contents = Content::Dot;
+                        break;
+                    case 'E':
+                        contents = Content::Energizer;
+                        break;
+                    case '$': // Tunnel exit sensor + Dot
+                        contents = Content::Dot | Content::TunnelSensor;
+                        break;
+                    case 'H':
+                        contents = Content::TunnelSensor;
+                        break;
+                    default:
+                        break;
+                }
+
+                if (contents & (Content::Dot | Content::Energizer))
+                    pelletCount_++;
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const NavigationTable& Maze::getNavigationTable() const {
+        return navTable_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const DistanceTable& Maze::getDistanceTable() const {
+        return distanceTable_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const JunctionGraph& Maze::getJunctionGraph() const {
+        return junctionGraph_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const TileAttributes& Maze::getTileAttributes() const {
+        return tileAttributes_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const FlowField& Maze::getRespawnFlowField() const {
+        return respawnFlowField_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int Maze::getRowCount() const {
+        return rowCount_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int Maze::getColumnCount() const {
+        return colmCount_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int Maze::getPelletCount() const {
+        return pelletCount_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    TileIndex Maze::getFruitSpawnTile() const {
+        return fruitSpawnTile_;
+    }
+
+} // namespace pm
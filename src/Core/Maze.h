@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_MAZE_H
+#define PACMAN_MAZE_H
+
+#include "Grid2D/MazeLayout.h"
+#include "Grid2D/NavigationTable.h"
+#include "Grid2D/DistanceTable.h"
+#include "Grid2D/JunctionGraph.h"
+#include "Grid2D/TileAttributes.h"
+#include "Grid2D/FlowField.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace pm {
+    /**
+     * @brief The static data the gameplay rules need to know about a maze
+     *
+     * Unlike pm::Grid, a maze does not depend on the engine. It is built
+     * once and never modified afterwards, so any number of game states
+     * can be simulated on the same maze at the same time
+     */
+    class Maze {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * The maze is empty until it is created or loaded from a file
+         */
+        Maze();
+
+        /**
+         * @brief Load the maze from the files the game loads its grid from
+         * @param filename The name of the file that contains the maze
+         * @param attributesFilename The name of the file that contains the
+         *                           tile attributes of the maze
+         * @return True if the maze was loaded, or false if either file
+         *         could not be read, the two files differ in size, the
+         *         maze has more than GameState::MAX_TILE_COUNT tiles or
+         *         it has no fruit spawn tile
+         *
+         * The maze is left unchanged if it could not be loaded
+         */
+        bool loadFromFile(const std::string& filename, const std::string& attributesFilename);
+
+        /**
+         * @brief Create the maze
+         * @param layout The tile ids of the maze (see res/TextFiles/maze.txt)
+         * @param attributes The tile attribute ids of the maze
+         *
+         * @warning Both layouts must have the same size, at most
+         * GameState::MAX_TILE_COUNT tiles and a fruit spawn tile. Unlike
+         * loadFromFile, this function does not check them
+         */
+        void create(const MazeLayout& layout, const MazeLayout& attributes);
+
+        /**
+         * @brief Get the navigation table of the maze
+         * @return The navigation table of the maze
+         */
+        const NavigationTable& getNavigationTable() const;
+
+        /**
+         * @brief Get the shortest path distances between the tiles of the maze
+         * @return The distance table of the maze
+         */
+        const DistanceTable& getDistanceTable() const;
+
+        /**
+         * @brief Get the junction graph of the maze
+         * @return The junction graph of the maze
+         */
+        const JunctionGraph& getJunctionGraph() const;
+
+        /**
+         * @brief Get the gameplay attributes of the tiles of the maze
+         * @return The tile attributes of the maze
+         */
+        const TileAttributes& getTileAttributes() const;
+
+        /**
+         * @brief Get the flow field that leads eaten ghosts to their respawn tile
+         * @return The flow field towards the ghost respawn tile
+         */
+        const FlowField& getRespawnFlowField() const;
+
+        /**
+         * @brief Get the number of rows in the maze
+         * @return The number of rows in the maze
+         */
+        int getRowCount() const;
+
+        /**
+         * @brief Get the number of columns in the maze
+         * @return The number of columns in the maze
+         */
+        int getColumnCount() const;
+
+        /**
+         * @brief Get the number of pellets in the maze when a level starts
+         * @return The number of dots and energizers in the maze
+         */
+        int getPelletCount() const;
+
+        /**
+         * @brief Get the tile fruits appear on
+         * @return The fruit spawn tile
+         */
+        TileIndex getFruitSpawnTile() const;
+
+        /**
+         * @brief Get the id of a tile
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return The position of the tile in row by row storage
+         */
+        int toTileId(int row, int colm) const {
+            return row * colmCount_ + colm;
+        }
+
+        /**
+         * @brief Check if a tile holds a pellet when a level starts
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return True if the tile holds a dot or an energizer, otherwise false
+         */
+        bool hasPellet(int row, int colm) const {
+            return (getContents(row, colm) & (Content::Dot | Content::Energizer)) != 0;
+        }
+
+        /**
+         * @brief Check if the pellet on a tile is an energizer
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return True if the tile holds an energizer, otherwise false
+         */
+        bool isEnergizer(int row, int colm) const {
+            return (getContents(row, colm) & Content::Energizer) != 0;
+        }
+
+        /**
+         * @brief Check if a tile has a tunnel sensor
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return True if ghosts update their tunnel speed on the tile,
+         *         otherwise false
+         */
+        bool isTunnelSensor(int row, int colm) const {
+            return (getContents(row, colm) & Content::TunnelSensor) != 0;
+        }
+
+    private:
+        /**
+         * @brief The objects a tile holds when a level starts
+         */
+        enum Content : std::uint8_t {
+            Dot          = 1 << 0, //!< The tile holds a dot
+            Energizer    = 1 << 1, //!< The tile holds an energizer
+            TunnelSensor = 1 << 2  //!< The tile holds a tunnel entry or exit sensor
+        };
+
+        /**
+         * @brief Get the objects a tile holds when a level starts
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return A mask of pm::Maze::Content values
+         */
+        std::uint8_t getContents(int row, int colm) const {
+            return navTable_.contains(row, colm) ? contents_[static_cast<std::size_t>(toTileId(row, colm))] : 0;
+        }
+
+    private:
+        int rowCount_;                       //!< The number of rows in the maze
+        int colmCount_;                      //!< The number of columns in the maze
+        int pelletCount_;                    //!< The number of pellets in the maze when a level starts
+        TileIndex fruitSpawnTile_;           //!< The tile fruits appear on
+        NavigationTable navTable_;           //!< Open exits of each tile
+        DistanceTable distanceTable_;        //!< Shortest path distances between tiles
+        JunctionGraph junctionGraph_;        //!< Corridors of the maze
+        TileAttributes tileAttributes_;      //!< Gameplay attributes of each tile
+        FlowField respawnFlowField_;         //!< Directions towards the ghost respawn tile
+        std::vector<std::uint8_t> contents_; //!< Objects on each tile when a level starts, stored row by row
+    };
+}
+
+#endif //PACMAN_MAZE_H
@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "PlaneEncoder.h"
+#include <algorithm>
+
+namespace pm {
+    ///////////////////////////////////////////////////////////////
+    PlaneEncoder::PlaneEncoder(const Maze& maze) :
+        rowCount_{maze.getRowCount()},
+        colmCount_{maze.getColumnCount()},
+        planeSize_{static_cast<std::size_t>(rowCount_ * colmCount_)},
+        fruitTile_{maze.getFruitSpawnTile()},
+        walls_(planeSize_),
+        energizers_{}
+    {
+        for (int row = 0; row < rowCount_; row++) {
+            for (int colm = 0; colm < colmCount_; colm++) {
+                int tileId = maze.toTileId(row, colm);
+                walls_[static_cast<std::size_t>(tileId)] = !maze.getNavigationTable().isWalkable(row, colm);
+
+                if (maze.isEnergizer(row, colm))
+                    energizers_[tileId >> 6] |= std::uint64_t{1} << (tileId & 63);
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t PlaneEncoder::getPlaneSize() const {
+        return planeSize_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t PlaneEncoder::getObservationSize() const {
+        return PlaneCount * planeSize_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void PlaneEncoder::encode(const GameState& state, std::uint8_t* out) const {
+        encodePlanes(state, out);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void PlaneEncoder::encode(const GameState& state, float* out) const {
+        encodePlanes(state, out);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    template <typename T>
+    void PlaneEncoder::encodePlanes(const GameState& state, T* out) const {
+        std::copy(walls_.begin(), walls_.end(), out + Walls * planeSize_);
+        expandPellets(state, false, out + Dots * planeSize_);
+        expandPellets(state, true, out + Energizers * planeSize_);
+
+        // The actor planes are empty apart from a handful of tiles
+        std::fill(out + PacMan * planeSize_, out + PlaneCount * planeSize_, T{0});
+        markTile(state.pacman.mover.tile, out + PacMan * planeSize_);
+
+        for (int id = 0; id < GhostId::GhostCount; id++) {
+            const GhostActor& ghost = state.ghosts[id];
+            markTile(ghost.mover.tile, out + (Blinky + id) * planeSize_);
+
+            if (ghost.mode == GhostMode::Frightened)
+                markTile(ghost.mover.tile, out + Frightened * planeSize_);
+        }
+
+        if (state.fruit.isActive)
+            markTile(fruitTile_, out + Fruit * planeSize_);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    template <typename T>
+    void PlaneEncoder::expandPellets(const GameState& state, bool isEnergizer, T* plane) const {
+        for (std::size_t base = 0; base < planeSize_; base += 64) {
+            std::uint64_t word = state.pellets[base >> 6] & (isEnergizer ? energizers_[base >> 6] : ~energizers_[base >> 6]);
+            std::size_t count = std::min<std::size_t>(64, planeSize_ - base);
+
+            for (std::size_t bit = 0; bit < count; bit++)
+                plane[base + bit] = static_cast<T>((word >> bit) & 1u);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    template <typename T>
+    void PlaneEncoder::markTile(TileIndex tile, T* plane) const {
+        // Actors passing through a tunnel may briefly be outside the maze
+        if (tile.row >= 0 && tile.row < rowCount_ && tile.colm >= 0 && tile.colm < colmCount_)
+            plane[tile.row * colmCount_ + tile.colm] = T{1};
+    }
+
+} // namespace pm
@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_PLANEENCODER_H
+#define PACMAN_PLANEENCODER_H
+
+#include "Core/Maze.h"
+#include "Core/GameState.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace pm {
+    /**
+     * @brief Encodes a game state as a stack of maze sized planes
+     *
+     * Every plane has one value per tile, 1 where the plane's object is on
+     * the tile and 0 elsewhere. The planes are written one after the other
+     * in pm::PlaneEncoder::Plane order, each one row by row, into a buffer
+     * owned by the caller (a planes x rows x columns tensor)
+     *
+     * The walls plane and the tiles of the energizers are computed once
+     * from the maze, so encoding a state allocates nothing and is mostly
+     * straight copies and bit expansions over contiguous memory
+     */
+    class PlaneEncoder {
+    public:
+        /**
+         * @brief The planes of an encoded state
+         */
+        enum Plane {
+            Walls,      //!< Tiles actors cannot enter
+            Dots,       //!< Tiles that hold a dot
+            Energizers, //!< Tiles that hold an energizer
+            PacMan,     //!< The tile of pacman
+            Blinky,     //!< The tile of blinky
+            Pinky,      //!< The tile of pinky
+            Inky,       //!< The tile of inky
+            Clyde,      //!< The tile of clyde
+            Frightened, //!< The tiles of ghosts pacman can eat
+            Fruit,      //!< The tile of the fruit while one is on the maze
+            PlaneCount  //!< The number of planes
+        };
+
+        /**
+         * @brief Constructor
+         * @param maze The maze the encoded states are played in
+         */
+        explicit PlaneEncoder(const Maze& maze);
+
+        /**
+         * @brief Get the number of tiles in a plane
+         * @return The number of rows times the number of columns of the maze
+         */
+        std::size_t getPlaneSize() const;
+
+        /**
+         * @brief Get the number of values written by an encode
+         * @return PlaneCount times the plane size
+         */
+        std::size_t getObservationSize() const;
+
+        /**
+         * @brief Encode a state as bytes
+         * @param state The state to be encoded
+         * @param out The buffer to write getObservationSize() values to
+         */
+        void encode(const GameState& state, std::uint8_t* out) const;
+
+        /**
+         * @brief Encode a state as floats
+         * @param state The state to be encoded
+         * @param out The buffer to write getObservationSize() values to
+         */
+        void encode(const GameState& state, float* out) const;
+
+    private:
+        /**
+         * @brief Encode a state
+         * @param state The state to be encoded
+         * @param out The buffer to write getObservationSize() values to
+         */
+        template <typename T>
+        void encodePlanes(const GameState& state, T* out) const;
+
+        /**
+         * @brief Expand pellet bits into a plane
+         * @param state The state whose pellets are expanded
+         * @param isEnergizer True to expand the energizers, or false to expand the dots
+         * @param plane The plane to write to
+         */
+        template <typename T>
+        void expandPellets(const GameState& state, bool isEnergizer, T* plane) const;
+
+        /**
+         * @brief Mark the tile of an actor in a plane
+         * @param tile The tile of the actor
+         * @param plane The plane to mark the tile in
+         */
+        template <typename T>
+        void markTile(TileIndex tile, T* plane) const;
+
+    private:
+        int rowCount_;                                               //!< The number of rows in the maze
+        int colmCount_;                                              //!< The number of columns in the maze
+        std::size_t planeSize_;                                      //!< The number of tiles in the maze
+        TileIndex fruitTile_;                                        //!< The tile fruits appear on
+        std::vector<std::uint8_t> walls_;                            //!< The walls plane
+        std::uint64_t energizers_[GameState::MAX_TILE_COUNT / 64];   //!< The energizer tiles in the layout of pm::GameState::pellets
+    };
+}
+
+#endif //PACMAN_PLANEENCODER_H
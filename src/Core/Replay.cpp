@@ -0,0 +1,399 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Replay.h"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+namespace pm {
+    namespace {
+        const char MAGIC[] = {'P', 'M', 'R', 'P'};
+        const char INDEX_MAGIC[] = {'P', 'M', 'K', 'I'};
+        const std::uint8_t VERSION = 3;
+
+        /**
+         * @brief Fold a state hash into a single byte
+         *
+         * A byte per step keeps a replay small. Once a game diverges its
+         * state rarely converges back, so a collision only delays the
+         * report by a step or two
+         */
+        std::uint8_t foldHash(std::uint32_t hash) {
+            return static_cast<std::uint8_t>(hash ^ (hash >> 8) ^ (hash >> 16) ^ (hash >> 24));
+        }
+
+        void writeVarint(std::vector<std::uint8_t>& buffer, std::uint64_t value) {
+            while (value >= 0x80) {
+                buffer.push_back(static_cast<std::uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+
+            buffer.push_back(static_cast<std::uint8_t>(value));
+        }
+
+        void writeUint32(std::vector<std::uint8_t>& buffer, std::uint32_t value) {
+            for (int i = 0; i < 4; i++)
+                buffer.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+        }
+
+        // Byte by byte, a range insert from char to uint8_t trips GCC's -Wstringop-overflow
+        void writeMagic(std::vector<std::uint8_t>& buffer, const char (&magic)[4]) {
+            for (char byte : magic)
+                buffer.push_back(static_cast<std::uint8_t>(byte));
+        }
+
+        /**
+         * @brief Reads the values written by the write functions above
+         *
+         * Reading past the end of the buffer sets a failure flag instead of
+         * throwing, so a truncated file is detected with a single check
+         */
+        class Reader {
+        public:
+            explicit Reader(const std::vector<std::uint8_t>& buffer) :
+                buffer_{buffer},
+                pos_{0},
+                isFailed_{false}
+            {}
+
+            std::uint8_t readByte() {
+                if (pos_ >= buffer_.size()) {
+                    isFailed_ = true;
+                    return 0;
+                }
+
+                return buffer_[pos_++];
+            }
+
+            std::uint64_t readVarint() {
+                std::uint64_t value = 0;
+
+                for (int shift = 0; shift < 64; shift += 7) {
+                    std::uint8_t byte = readByte();
+                    value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+
+                    if (!(byte & 0x80))
+                        return value;
+                }
+
+                isFailed_ = true;
+                return 0;
+            }
+
+            std::uint32_t readUint32() {
+                std::uint32_t value = 0;
+                for (int i = 0; i < 4; i++)
+                    value |= static_cast<std::uint32_t>(readByte()) << (i * 8);
+
+                return value;
+            }
+
+            std::size_t getPosition() const {
+                return pos_;
+            }
+
+            void setPosition(std::size_t pos) {
+                isFailed_ = isFailed_ || pos > buffer_.size();
+                pos_ = pos;
+            }
+
+            std::size_t getRemaining() const {
+                return buffer_.size() - std::min(pos_, buffer_.size());
+            }
+
+            bool isFailed() const {
+                return isFailed_;
+            }
+
+        private:
+            const std::vector<std::uint8_t>& buffer_;
+            std::size_t pos_;
+            bool isFailed_;
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////
+    Replay::Replay() :
+        seed_{0},
+        hashInterval_{1},
+        tickCount_{0},
+        finalHash_{0}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    void Replay::record(const Simulation& simulation, GameState& state, std::uint64_t seed,
+        const InputScript& input, std::uint64_t maxTicks, std::uint32_t hashInterval, std::uint64_t keyframeInterval)
+    {
+        assert(hashInterval > 0 && "The hash interval must be at least one step");
+
+        seed_ = seed;
+        hashInterval_ = hashInterval;
+        events_.clear();
+        hashes_.clear();
+        keyframes_.clear();
+        simulation.reset(state, seed);
+
+        const std::vector<InputEvent>& scriptEvents = input.getEvents();
+        auto nextEvent = scriptEvents.begin();
+
+        while (state.phase != GamePhase::GameOver && state.tick < maxTicks) {
+            Dir dir = Dir::None;
+            while (nextEvent != scriptEvents.end() && nextEvent->tick <= state.tick)
+                dir = (nextEvent++)->dir;
+
+            if (dir != Dir::None)
+                events_.push_back(InputEvent{state.tick, dir});
+
+            simulation.step(state, dir);
+
+            if (state.tick % hashInterval_ == 0)
+                hashes_.push_back(foldHash(computeStateHash(state)));
+
+            if (keyframeInterval > 0 && state.tick % keyframeInterval == 0) {
+                keyframes_.emplace_back();
+                keyframes_.back().capture(state);
+            }
+        }
+
+        tickCount_ = state.tick;
+        finalHash_ = computeStateHash(state);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    ReplayCheck Replay::play(const Simulation& simulation, GameState& state) const {
+        simulation.reset(state, seed_);
+
+        ReplayCheck check;
+        auto nextEvent = events_.begin();
+
+        while (state.phase != GamePhase::GameOver && state.tick < tickCount_) {
+            Dir dir = Dir::None;
+            if (nextEvent != events_.end() && nextEvent->tick == state.tick)
+                dir = (nextEvent++)->dir;
+
+            simulation.step(state, dir);
+
+            if (state.tick % hashInterval_ == 0 && hashes_[state.tick / hashInterval_ - 1] != foldHash(computeStateHash(state))) {
+                check.isDiverged = true;
+                break;
+            }
+        }
+
+        // A game that ends early or in a different state diverged after the last hash
+        if (!check.isDiverged)
+            check.isDiverged = state.tick != tickCount_ || computeStateHash(state) != finalHash_;
+
+        check.divergedTick = check.isDiverged ? state.tick : 0;
+        check.tickCount = state.tick;
+        return check;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool Replay::seek(const Simulation& simulation, GameState& state, std::uint64_t tick) const {
+        if (tick > tickCount_)
+            return false;
+
+        auto keyframe = std::upper_bound(keyframes_.begin(), keyframes_.end(), tick, [](std::uint64_t tick, const Snapshot& snapshot) {
+            return tick < snapshot.getState().tick;
+        });
+
+        if (keyframe == keyframes_.begin())
+            simulation.reset(state, seed_);
+        else
+            std::prev(keyframe)->restore(state);
+
+        auto nextEvent = std::lower_bound(events_.begin(), events_.end(), state.tick, [](const InputEvent& event, std::uint64_t tick) {
+            return event.tick < tick;
+        });
+
+        while (state.tick < tick) {
+            Dir dir = Dir::None;
+            if (nextEvent != events_.end() && nextEvent->tick == state.tick)
+                dir = (nextEvent++)->dir;
+
+            simulation.step(state, dir);
+        }
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool Replay::saveToFile(const std::string& filename) const {
+        std::vector<std::uint8_t> buffer;
+        writeMagic(buffer, MAGIC);
+        buffer.push_back(VERSION);
+        writeVarint(buffer, seed_);
+        writeVarint(buffer, hashInterval_);
+        writeVarint(buffer, tickCount_);
+        writeVarint(buffer, events_.size());
+
+        std::uint64_t prevTick = 0;
+        for (const InputEvent& event : events_) {
+            writeVarint(buffer, ((event.tick - prevTick) << 2) | static_cast<std::uint64_t>(event.dir));
+            prevTick = event.tick;
+        }
+
+        buffer.insert(buffer.end(), hashes_.begin(), hashes_.end());
+        writeUint32(buffer, finalHash_);
+
+        std::vector<std::uint64_t> keyframeOffsets;
+        for (const Snapshot& keyframe : keyframes_) {
+            keyframeOffsets.push_back(buffer.size());
+            keyframe.serialize(buffer);
+        }
+
+        auto indexOffset = static_cast<std::uint32_t>(buffer.size());
+        writeVarint(buffer, keyframes_.size());
+
+        for (std::size_t i = 0; i < keyframes_.size(); i++) {
+            writeVarint(buffer, keyframes_[i].getState().tick);
+            writeVarint(buffer, keyframeOffsets[i]);
+        }
+
+        writeUint32(buffer, indexOffset);
+        writeMagic(buffer, INDEX_MAGIC);
+
+        std::ofstream file(filename, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        return static_cast<bool>(file);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool Replay::loadFromFile(const std::string& filename) {
+        std::ifstream file(filename, std::ios::binary);
+        if (!file)
+            return false;
+
+        std::vector<std::uint8_t> buffer{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+        Reader reader{buffer};
+
+        for (char magic : MAGIC) {
+            if (reader.readByte() != static_cast<std::uint8_t>(magic))
+                return false;
+        }
+
+        if (reader.readByte() != VERSION)
+            return false;
+
+        std::uint64_t seed = reader.readVarint();
+        std::uint64_t hashInterval = reader.readVarint();
+        std::uint64_t tickCount = reader.readVarint();
+        std::uint64_t eventCount = reader.readVarint();
+
+        if (reader.isFailed() || hashInterval == 0 || hashInterval > UINT32_MAX || eventCount > reader.getRemaining())
+            return false;
+
+        std::vector<InputEvent> events;
+        events.reserve(eventCount);
+        std::uint64_t tick = 0;
+
+        for (std::uint64_t i = 0; i < eventCount; i++) {
+            std::uint64_t value = reader.readVarint();
+            tick += value >> 2;
+
+            // Presses are stored one per step, in step order
+            if (reader.isFailed() || (i > 0 && (value >> 2) == 0) || tick >= tickCount)
+                return false;
+
+            events.push_back(InputEvent{tick, static_cast<Dir>(value & 3)});
+        }
+
+        // The keyframe index is found through the footer at the end of the file
+        std::uint64_t hashCount = tickCount / hashInterval;
+        if (hashCount > buffer.size())
+            return false;
+
+        std::size_t keyframesStart = reader.getPosition() + hashCount + 4;
+        if (buffer.size() < 8 || std::memcmp(buffer.data() + buffer.size() - 4, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0)
+            return false;
+
+        reader.setPosition(buffer.size() - 8);
+        std::size_t indexOffset = reader.readUint32();
+        if (keyframesStart > indexOffset || indexOffset > buffer.size() - 8)
+            return false;
+
+        reader.setPosition(keyframesStart - hashCount - 4);
+        std::vector<std::uint8_t> hashes;
+        hashes.reserve(hashCount);
+        for (std::uint64_t i = 0; i < hashCount; i++)
+            hashes.push_back(reader.readByte());
+
+        std::uint32_t finalHash = reader.readUint32();
+
+        reader.setPosition(indexOffset);
+        std::uint64_t keyframeCount = reader.readVarint();
+        if (reader.isFailed() || keyframeCount > (indexOffset - keyframesStart) / Snapshot::SERIALIZED_SIZE)
+            return false;
+
+        std::vector<Snapshot> keyframes(keyframeCount);
+        for (Snapshot& keyframe : keyframes) {
+            std::uint64_t keyframeTick = reader.readVarint();
+            std::uint64_t offset = reader.readVarint();
+
+            if (reader.isFailed() || offset < keyframesStart || offset > indexOffset - Snapshot::SERIALIZED_SIZE
+                || !keyframe.deserialize(buffer.data() + offset, Snapshot::SERIALIZED_SIZE)
+                || keyframe.getState().tick != keyframeTick || keyframeTick > tickCount
+                || (&keyframe != &keyframes.front() && keyframeTick <= (&keyframe - 1)->getState().tick))
+            {
+                return false;
+            }
+        }
+
+        if (reader.getPosition() != buffer.size() - 8)
+            return false;
+
+        seed_ = seed;
+        hashInterval_ = static_cast<std::uint32_t>(hashInterval);
+        tickCount_ = tickCount;
+        events_ = std::move(events);
+        hashes_ = std::move(hashes);
+        finalHash_ = finalHash;
+        keyframes_ = std::move(keyframes);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::uint64_t Replay::getSeed() const {
+        return seed_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::uint64_t Replay::getTickCount() const {
+        return tickCount_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const std::vector<InputEvent>& Replay::getEvents() const {
+        return events_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t Replay::getKeyframeCount() const {
+        return keyframes_.size();
+    }
+
+} // namespace pm
@@ -0,0 +1,172 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_REPLAY_H
+#define PACMAN_REPLAY_H
+
+#include "Core/InputScript.h"
+#include "Core/Snapshot.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace pm {
+    /**
+     * @brief The outcome of playing back a replay
+     */
+    struct ReplayCheck {
+        bool isDiverged = false;        //!< True if the game did not reproduce the recorded states
+        std::uint64_t divergedTick = 0; //!< The first hashed step whose state differs from the recording
+        std::uint64_t tickCount = 0;    //!< The number of steps that were played back
+    };
+
+    /**
+     * @brief A recorded game that can be played back and verified
+     *
+     * A replay stores the seed of the game, the key presses of the player
+     * and a hash of the state after every few steps. Playing it back
+     * re-simulates the game as fast as the CPU allows and compares the
+     * hashes, so a change that breaks determinism is reported with the
+     * step at which the game took a different course
+     *
+     * The file is binary: after the "PMRP" magic and a version byte come
+     * the seed, the hash interval, the step count and the key presses as
+     * variable length integers. A key press is stored as the number of
+     * steps since the previous one, shifted left by two, with the direction
+     * in the two low bits. The state hashes follow as one byte per interval,
+     * then the full 32-bit hash of the final state
+     *
+     * Long games also store a pm::Snapshot of the state every so many
+     * steps (a keyframe), so that any step can be reached by restoring the
+     * nearest earlier keyframe instead of re-simulating from the start. An
+     * index of the keyframes (their count followed by the step and file
+     * offset of each one as variable length integers) is written after
+     * them, and the file ends with the 32-bit offset of the index and the
+     * "PMKI" magic
+     */
+    class Replay {
+    public:
+        static constexpr std::uint32_t DEFAULT_HASH_INTERVAL = 60;       //!< One state hash per half second of game time
+        static constexpr std::uint64_t DEFAULT_KEYFRAME_INTERVAL = 7200; //!< One keyframe per minute of game time
+
+        /**
+         * @brief Constructor
+         */
+        Replay();
+
+        /**
+         * @brief Record a game
+         * @param simulation The simulation that advances the game
+         * @param state The state to play the game in, it is reset by this function
+         * @param seed The seed of the game
+         * @param input The key presses of the player
+         * @param maxTicks The maximum number of steps to record
+         * @param hashInterval The number of steps between two state hashes,
+         *                     1 finds the exact step a playback diverges in
+         * @param keyframeInterval The number of steps between two keyframes, or 0 for no keyframes
+         *
+         * The game is advanced at pm::Simulation::TIMESTEP until it is
+         * over or @a maxTicks steps were made. Key presses are matched to
+         * steps the same way as pm::InputScript::play
+         */
+        void record(const Simulation& simulation, GameState& state, std::uint64_t seed,
+            const InputScript& input, std::uint64_t maxTicks, std::uint32_t hashInterval = DEFAULT_HASH_INTERVAL,
+            std::uint64_t keyframeInterval = DEFAULT_KEYFRAME_INTERVAL);
+
+        /**
+         * @brief Play the recorded game back
+         * @param simulation The simulation that advances the game
+         * @param state The state to play the game in, it is reset by this function
+         * @return The outcome of the playback
+         *
+         * The playback stops at the first step whose state hash does not
+         * match the recorded one
+         */
+        ReplayCheck play(const Simulation& simulation, GameState& state) const;
+
+        /**
+         * @brief Bring a game to a recorded step
+         * @param simulation The simulation that advances the game
+         * @param state The state to overwrite with the state at @a tick
+         * @param tick The step to seek to
+         * @return True if the game was brought to @a tick, or false if
+         *         @a tick is past the last recorded step
+         *
+         * The state is restored from the nearest keyframe at or before
+         * @a tick and then advanced with the recorded key presses, so the
+         * cost of a seek does not depend on how far into the game it goes
+         */
+        bool seek(const Simulation& simulation, GameState& state, std::uint64_t tick) const;
+
+        /**
+         * @brief Save the replay to a file
+         * @param filename The name of the file to save the replay to
+         * @return True if the replay was saved, otherwise false
+         */
+        bool saveToFile(const std::string& filename) const;
+
+        /**
+         * @brief Load the replay from a file
+         * @param filename The name of the file that contains the replay
+         * @return True if the replay was loaded, or false if the file could
+         *         not be read or is not a valid replay
+         */
+        bool loadFromFile(const std::string& filename);
+
+        /**
+         * @brief Get the seed of the recorded game
+         * @return The seed of the game
+         */
+        std::uint64_t getSeed() const;
+
+        /**
+         * @brief Get the number of recorded steps
+         * @return The number of steps
+         */
+        std::uint64_t getTickCount() const;
+
+        /**
+         * @brief Get the recorded key presses
+         * @return The key presses, ordered by step
+         */
+        const std::vector<InputEvent>& getEvents() const;
+
+        /**
+         * @brief Get the number of keyframes in the replay
+         * @return The number of keyframes
+         */
+        std::size_t getKeyframeCount() const;
+
+    private:
+        std::uint64_t seed_;               //!< The seed of the game
+        std::uint32_t hashInterval_;       //!< The number of steps between two state hashes
+        std::uint64_t tickCount_;          //!< The number of recorded steps
+        std::vector<InputEvent> events_;   //!< Key presses that reached the simulation, one per step at most
+        std::vector<std::uint8_t> hashes_; //!< The folded state hash after every hashInterval_ steps
+        std::uint32_t finalHash_;          //!< The full hash of the state after the last step
+        std::vector<Snapshot> keyframes_;  //!< The state after every keyframe interval, ordered by step
+    };
+}
+
+#endif //PACMAN_REPLAY_H
@@ -0,0 +1,808 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Simulation.h"
+#include "Core/ChaseTargets.h"
+#include "Core/LevelRules.h"
+#include "Common/Constants.h"
+#include "PathFinders/GhostDecisionKernel.h"
+#include <cassert>
+#include <cmath>
+
+namespace pm {
+    namespace {
+        /**
+         * @brief What makes a ghost different from the other ghosts
+         *        (see pm::GhostPersonality)
+         */
+        struct GhostTraits {
+            TileIndex spawnTile;                              //!< The tile the ghost is placed on when a level starts
+            Dir levelStartDirection;                          //!< The direction the ghost faces when it is created
+            Dir spawnDirection;                               //!< The direction the ghost faces when the actors are reset
+            TileIndex scatterTargetTile;                      //!< The tile the ghost targets when in scatter mode
+            int lastHouseArrestLevel;                         //!< The last level in which the ghost starts locked in the ghost house
+            TileIndex (*getChaseTarget)(const ChaseContext&); //!< Computes the tile the ghost targets when in chase mode
+        };
+
+        const GhostTraits ghostTraits[GhostCount] = {
+            {Constants::BLINKY_SPAWN_TILE, Dir::Right, Dir::Left, Constants::BLINKY_SCATTER_TARGET_TILE, 0, &chaseLikeBlinky},
+            {Constants::PINKY_SPAWN_TILE,  Dir::Down,  Dir::Down, Constants::PINKY_SCATTER_TARGET_TILE,  1, &chaseLikePinky},
+            {Constants::INKY_SPAWN_TILE,   Dir::Up,    Dir::Up,   Constants::INKY_SCATTER_TARGET_TILE,   2, &chaseLikeInky},
+            {Constants::CLYDE_SPAWN_TILE,  Dir::Up,    Dir::Up,   Constants::CLYDE_SCATTER_TARGET_TILE,  3, &chaseLikeClyde}
+        };
+
+        const float PACMAN_DEATH_DURATION = 3.4f;     // Death animation plus the pause after it
+        const float LEVEL_COMPLETE_DURATION = 3.5f;   // Freeze, grid flash and the pause after it
+        const float BOOT_COUNTDOWN_FACTOR = 2.15f;    // The first countdown waits for the intro jingle
+
+        // Timers stopped when pacman dies or the level is complete
+        const std::uint16_t GAMEPLAY_TIMERS = TimerWheel::mask(GhostHouseTimer) | TimerWheel::mask(ChaseModeTimer)
+            | TimerWheel::mask(ScatterModeTimer) | TimerWheel::mask(FrightenedModeTimer) | TimerWheel::mask(UneatenFruitTimer);
+
+        // Timers that stand still while a caught ghost freezes the game, the
+        // eaten delay of the ghost itself keeps running
+        const std::uint16_t GHOST_CAUGHT_FROZEN_TIMERS = TimerWheel::mask(FrightenedModeTimer) | TimerWheel::mask(UneatenFruitTimer);
+
+        const std::uint16_t EATEN_DELAY_TIMERS = static_cast<std::uint16_t>(((1u << GhostCount) - 1) << EatenDelayTimer);
+
+        /**
+         * @brief Convert a duration to a number of steps
+         * @param duration The duration in seconds
+         * @return The number of steps of pm::Simulation::TIMESTEP that last
+         *         at least @a duration, and at least one step
+         */
+        std::uint64_t toTicks(float duration) {
+            // The tolerance absorbs the rounding error of durations that are a whole number of steps
+            double ticks = std::ceil(static_cast<double>(duration) / Simulation::TIMESTEP - 1e-3);
+            return ticks < 1.0 ? 1 : static_cast<std::uint64_t>(ticks);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    Simulation::Simulation(const Maze& maze, const LevelRules& rules) :
+        maze_{maze},
+        rules_{rules}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::reset(GameState& state, std::uint64_t seed) const {
+        state = GameState();
+        state.seed = seed;
+        state.pacman.lives = Constants::PLAYER_LiVES;
+        startLevel(state);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::startLevel(GameState& state) const {
+        state.random.seed(state.seed, static_cast<std::uint64_t>(state.level));
+        state.eatenPelletCount = 0;
+        state.remainingPelletCount = 0;
+        state.pointsMultiplier = 1;
+        state.scatterWave = 0;
+        state.chaseWave = 0;
+        state.fruit.isActive = false;
+        stopTimers(state);
+
+        for (auto& bits : state.pellets)
+            bits = 0;
+
+        for (int row = 0; row < maze_.getRowCount(); row++) {
+            for (int colm = 0; colm < maze_.getColumnCount(); colm++) {
+                if (maze_.hasPellet(row, colm)) {
+                    state.addPellet(maze_.toTileId(row, colm));
+                    state.remainingPelletCount++;
+                }
+            }
+        }
+
+        resetActors(state);
+
+        // A new level creates new actors, which face their default directions
+        state.pacman.mover.direction = Dir::Left;
+        for (int i = 0; i < GhostCount; i++)
+            state.ghosts[i].mover.direction = ghostTraits[i].levelStartDirection;
+
+        startCountDown(state);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::resetActors(GameState& state) const {
+        // Pacman
+        PacManActor& pacman = state.pacman;
+        pacman.mover = MoverState{};
+        pacman.mover.tile = Constants::PACMAN_SPAWN_TILE;
+        pacman.mover.direction = Dir::Left;
+        pacman.pendingDir = Dir::None;
+        pacman.mode = PacManMode::Idle;
+
+        // Ghosts
+        state.ghostsInHouse = 0;
+        for (int i = 0; i < GhostCount; i++) {
+            GhostActor& ghost = state.ghosts[i];
+            ghost = GhostActor{};
+            ghost.mover.tile = ghostTraits[i].spawnTile;
+            ghost.mover.direction = ghostTraits[i].spawnDirection;
+
+            if (state.level <= ghostTraits[i].lastHouseArrestLevel) {
+                ghost.isLocked = true;
+                state.ghostsInHouse += 1;
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::startCountDown(GameState& state) const {
+        state.phase = GamePhase::Countdown;
+        state.timers.start(PhaseTimer, toTicks(state.isBoot ? BOOT_COUNTDOWN_FACTOR * Constants::LEVEL_START_DELAY : Constants::LEVEL_START_DELAY));
+        state.isBoot = false;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::endPhase(GameState& state) const {
+        switch (state.phase) {
+            case GamePhase::Countdown:
+                state.phase = GamePhase::Playing;
+                state.pacman.mode = PacManMode::Moving;
+                requestMove(state.pacman.mover, state.pacman.mover.direction, false);
+
+                if (state.ghostsInHouse > 0)
+                    state.timers.start(GhostHouseTimer, toTicks(Constants::PINKY_HOUSE_ARREST_DURATION)); // Pinky is freed first
+
+                startGhostScatterMode(state);
+                break;
+            case GamePhase::PacManDying:
+                if (state.pacman.lives <= 0)
+                    state.phase = GamePhase::GameOver;
+                else {
+                    resetActors(state);
+                    startCountDown(state);
+                }
+                break;
+            case GamePhase::LevelComplete:
+                state.level += 1;
+                startLevel(state);
+                break;
+            default:
+                break;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::step(GameState& state, Dir input, float dt) const {
+        if (state.phase == GamePhase::GameOver)
+            return;
+
+        // Clamped before the conversion, which is undefined for NaN and out of range values
+        float ticks = std::round(dt / TIMESTEP);
+        unsigned int tickCount = !(ticks >= 1.0f) ? 1u : ticks >= static_cast<float>(MAX_STEP_TICKS) ? MAX_STEP_TICKS : static_cast<unsigned int>(ticks);
+
+        if (input != Dir::None && state.phase == GamePhase::Playing)
+            handleInput(state, input);
+
+        // Actors only collide when they reach a tile, so jumping from one such
+        // tick to the next cannot make them pass through each other
+        for (unsigned int tick = 0; tick < tickCount && state.phase != GamePhase::GameOver; tick++) {
+            unsigned int quietTicks = getQuietTickCount(state, tickCount - tick - 1);
+            skipQuietTicks(state, quietTicks);
+            tick += quietTicks;
+
+            updateTick(state);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    unsigned int Simulation::advance(GameState& state, Dir input, unsigned int tickCount) const {
+        unsigned int ticks = 0;
+
+        for (; ticks < tickCount && state.phase != GamePhase::GameOver; ticks++)
+            step(state, input);
+
+        return ticks;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::handleInput(GameState& state, Dir dir) const {
+        PacManActor& pacman = state.pacman;
+
+        if (isOpenForPacMan(state, dir) && pacman.mover.moveDir == Dir::None) {
+            pacman.pendingDir = Dir::None;
+            requestMove(pacman.mover, dir, pacman.mode != PacManMode::Moving);
+        } else
+            pacman.pendingDir = dir;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::updateTick(GameState& state) const {
+        state.tick++;
+
+        // Pacman
+        if (advanceMover(state.pacman.mover, rules_.getPacManSpeed(state.level)))
+            onPacManMoveEnd(state);
+
+        // Ghosts (they are removed from the maze once the level is complete)
+        if (state.phase != GamePhase::LevelComplete) {
+            for (int i = 0; i < GhostCount; i++) {
+                GhostActor& ghost = state.ghosts[i];
+                float speed = rules_.getGhostSpeed(state.level, ghost.mode, ghost.isInTunnel);
+
+                if (advanceMover(ghost.mover, speed))
+                    onGhostMoveEnd(state, static_cast<GhostId>(i));
+            }
+        }
+
+        updateTimers(state);
+
+        if (state.phase == GamePhase::Playing && state.remainingPelletCount == 0)
+            completeLevel(state);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    unsigned int Simulation::getQuietTickCount(const GameState& state, unsigned int maxTicks) const {
+        unsigned int quietTicks = maxTicks;
+
+        // Each event shortens the window the next one is looked for in
+        std::uint64_t expiry = state.timers.getNextExpiry();
+        if (expiry != 0 && expiry - 1 < quietTicks)
+            quietTicks = static_cast<unsigned int>(expiry - 1);
+
+        unsigned int ticks = getTicksToTile(state.pacman.mover, rules_.getPacManSpeed(state.level), quietTicks);
+        if (ticks != 0)
+            quietTicks = ticks - 1;
+
+        if (state.phase != GamePhase::LevelComplete) {
+            for (const GhostActor& ghost : state.ghosts) {
+                float speed = rules_.getGhostSpeed(state.level, ghost.mode, ghost.isInTunnel);
+                ticks = getTicksToTile(ghost.mover, speed, quietTicks);
+
+                if (ticks != 0)
+                    quietTicks = ticks - 1;
+            }
+        }
+
+        return quietTicks;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::skipQuietTicks(GameState& state, unsigned int tickCount) const {
+        // Nothing that changes the speeds happens in a quiet tick
+        float pacmanSpeed = rules_.getPacManSpeed(state.level);
+        for (unsigned int tick = 0; tick < tickCount; tick++)
+            advanceMover(state.pacman.mover, pacmanSpeed);
+
+        if (state.phase != GamePhase::LevelComplete) {
+            for (GhostActor& ghost : state.ghosts) {
+                float speed = rules_.getGhostSpeed(state.level, ghost.mode, ghost.isInTunnel);
+
+                for (unsigned int tick = 0; tick < tickCount; tick++)
+                    advanceMover(ghost.mover, speed);
+            }
+        }
+
+        for (unsigned int tick = 0; tick < tickCount; tick++)
+            state.timers.advance();
+
+        state.tick += tickCount;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool Simulation::advanceMover(MoverState& mover, float speed) const {
+        if (mover.moveDir == Dir::None || mover.isFrozen)
+            return false;
+
+        mover.distance += speed * TIMESTEP;
+        if (mover.distance < static_cast<float>(Constants::GRID_TILE_SIZE))
+            return false;
+
+        mover.tile.row += rowOffset(mover.moveDir);
+        mover.tile.colm += colmOffset(mover.moveDir);
+        mover.moveDir = Dir::None;
+        mover.distance = 0.0f;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    unsigned int Simulation::getTicksToTile(const MoverState& mover, float speed, unsigned int maxTicks) const {
+        if (mover.moveDir == Dir::None || mover.isFrozen)
+            return 0;
+
+        // Accumulate like advanceMover() does, so the prediction matches to the bit
+        float distance = mover.distance;
+
+        for (unsigned int tick = 1; tick <= maxTicks; tick++) {
+            distance += speed * TIMESTEP;
+
+            if (distance >= static_cast<float>(Constants::GRID_TILE_SIZE))
+                return tick;
+        }
+
+        return 0;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::requestMove(MoverState& mover, Dir dir, bool isRestricted) const {
+        if (isRestricted || dir == Dir::None || mover.moveDir != Dir::None)
+            return;
+
+        if (!maze_.getNavigationTable().isWalkable(mover.tile.row + rowOffset(dir), mover.tile.colm + colmOffset(dir)))
+            return;
+
+        mover.moveDir = dir;
+        mover.direction = dir;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::teleport(MoverState& mover, bool isRestricted) const {
+        if (mover.tile.colm == 0) // Triggered the left-hand side sensor
+            mover.tile.colm = maze_.getColumnCount() - 1;
+        else
+            mover.tile.colm = 0;
+
+        requestMove(mover, mover.direction, isRestricted);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool Simulation::isOpenForPacMan(const GameState& state, Dir dir) const {
+        const TileIndex& tile = state.pacman.mover.tile;
+
+        if (dir == Dir::Down && maze_.getTileAttributes().has(tile.row, tile.colm, TileFlag::GhostHouseEntrance))
+            return false;
+
+        return maze_.getNavigationTable().isOpen(tile.row, tile.colm, dir);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::onPacManMoveEnd(GameState& state) const {
+        PacManActor& pacman = state.pacman;
+        const TileIndex& tile = pacman.mover.tile;
+
+        // Collisions
+        if (state.hasPellet(maze_.toTileId(tile.row, tile.colm)))
+            eatPellet(state);
+
+        if (state.fruit.isActive && tile == maze_.getFruitSpawnTile()) {
+            state.timers.stop(UneatenFruitTimer);
+            state.fruit.isActive = false;
+            updateScore(state, LevelRules::getFruitPoints(state.fruit.type));
+        }
+
+        if (state.phase != GamePhase::LevelComplete) {
+            for (int i = 0; i < GhostCount; i++) {
+                if (state.ghosts[i].mover.tile == tile)
+                    resolveGhostCollision(state, static_cast<GhostId>(i));
+            }
+        }
+
+        bool isRestricted = pacman.mode != PacManMode::Moving;
+        if (maze_.getTileAttributes().has(tile.row, tile.colm, TileFlag::Teleport))
+            teleport(pacman.mover, isRestricted);
+
+        // Keep pacman moving until he collides with a wall
+        if (pacman.pendingDir != Dir::None && isOpenForPacMan(state, pacman.pendingDir)) {
+            requestMove(pacman.mover, pacman.pendingDir, isRestricted);
+            pacman.pendingDir = Dir::None;
+        } else
+            requestMove(pacman.mover, pacman.mover.direction, isRestricted);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::onGhostMoveEnd(GameState& state, GhostId id) const {
+        GhostActor& ghost = state.ghosts[id];
+        const TileIndex& tile = ghost.mover.tile;
+
+        if (maze_.getTileAttributes().has(tile.row, tile.colm, TileFlag::Teleport))
+            teleport(ghost.mover, ghost.mode == GhostMode::Idle);
+
+        if (maze_.isTunnelSensor(tile.row, tile.colm))
+            ghost.isInTunnel = maze_.getTileAttributes().has(tile.row, tile.colm, TileFlag::Tunnel);
+
+        if (state.pacman.mover.tile == tile)
+            resolveGhostCollision(state, id);
+
+        moveGhost(state, id);
+
+        if (ghost.mode == GhostMode::Eaten && tile == Constants::EATEN_GHOST_RESPAWN_TILE)
+            setGhostMode(state, id, ghost.nextMode);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::moveGhost(GameState& state, GhostId id) const {
+        GhostActor& ghost = state.ghosts[id];
+        MoverState& mover = ghost.mover;
+        const TileIndex& tile = mover.tile;
+        bool isRestricted = ghost.mode == GhostMode::Idle;
+        bool isInGhostPen = maze_.getTileAttributes().has(tile.row, tile.colm, TileFlag::GhostHouse);
+
+        // In a corridor there is only one way forward, so there is nothing to decide
+        if (!isInGhostPen) {
+            Dir corridorDir = maze_.getJunctionGraph().getCorridorDirection(tile.row, tile.colm, mover.direction);
+
+            if (corridorDir != Dir::None) {
+                requestMove(mover, corridorDir, isRestricted);
+                return;
+            }
+        }
+
+        Dir reverseGhostDir = reverseDir(mover.direction);
+        std::uint8_t forbidden = dirBit(reverseGhostDir);
+        std::uint8_t flags = maze_.getTileAttributes().getFlags(tile.row, tile.colm);
+
+        if ((flags & tileFlagBit(TileFlag::NoUpForGhosts)) && ghost.mode != GhostMode::Frightened)
+            forbidden |= dirBit(Dir::Up);
+
+        if ((flags & tileFlagBit(TileFlag::GhostHouseEntrance)) && ghost.mode != GhostMode::Eaten)
+            forbidden |= dirBit(Dir::Down);
+
+        DirectionCandidates candidates = GhostDecisionKernel::getCandidates(maze_.getNavigationTable().getExits(tile.row, tile.colm), forbidden);
+        bool allowedInGhostHouse = ghost.isLocked || ghost.mode == GhostMode::Eaten;
+
+        if (isInGhostPen && ghost.isLocked) {
+            // Locked ghosts bounce up and down until they are released
+            if (!maze_.getTileAttributes().has(tile.row + rowOffset(mover.direction), tile.colm, TileFlag::GhostHouse))
+                requestMove(mover, reverseGhostDir, isRestricted);
+            else
+                requestMove(mover, mover.direction, isRestricted);
+        } else if (candidates.count == 0) // Ghost is in a dead end, only option is backwards (special case)
+            requestMove(mover, reverseGhostDir, isRestricted);
+        else if (candidates.count == 1) // Going forward is the only option
+            requestMove(mover, candidates.dirs[0], isRestricted);
+        else { // Multiple directions to move in
+            Dir dir;
+            if (isInGhostPen && !allowedInGhostHouse) { // Kick it out to the front door
+                const TileIndex& door = Constants::BLINKY_SPAWN_TILE;
+                dir = GhostDecisionKernel::getMinDistanceDirection(candidates, tile.row, tile.colm, door.row, door.colm);
+            } else if (ghost.strategy == MoveStrategy::Random)
+                dir = GhostDecisionKernel::getRandomDirection(candidates, state.random.next());
+            else {
+                dir = Dir::None;
+
+                // Eaten ghosts follow the precomputed shortest path home
+                if (ghost.mode == GhostMode::Eaten) {
+                    Dir flowDir = maze_.getRespawnFlowField().getDirection(tile.row, tile.colm);
+                    for (int i = 0; i < candidates.count; i++) {
+                        if (candidates.dirs[i] == flowDir)
+                            dir = flowDir;
+                    }
+                }
+
+                if (dir == Dir::None) {
+                    if (ghost.hasChaseTarget)
+                        ghost.targetTile = getChaseTarget(state, id);
+
+                    const TileIndex& target = ghost.targetTile;
+                    if (ghost.strategy == MoveStrategy::PathDistance)
+                        dir = GhostDecisionKernel::getMinPathDistanceDirection(candidates, maze_.getDistanceTable(), tile.row, tile.colm, target.row, target.colm);
+                    else
+                        dir = GhostDecisionKernel::getMinDistanceDirection(candidates, tile.row, tile.colm, target.row, target.colm);
+                }
+            }
+
+            requestMove(mover, dir, isRestricted);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::startGhostMovement(GameState& state, GhostId id) const {
+        GhostActor& ghost = state.ghosts[id];
+
+        if (!ghost.isMovementStarted) {
+            if (ghost.isLocked) {
+                Dir dir = ghost.mover.direction;
+                requestMove(ghost.mover, (dir != Dir::Up && dir != Dir::Down) ? Dir::Up : dir, false);
+            }
+
+            ghost.isMovementStarted = true;
+            moveGhost(state, id);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    TileIndex Simulation::getChaseTarget(const GameState& state, GhostId id) const {
+        ChaseContext context{state.ghosts[id].mover.tile, state.pacman.mover.tile,
+            state.pacman.mover.direction, state.ghosts[Blinky].mover.tile};
+
+        return ghostTraits[id].getChaseTarget(context);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::setGhostMode(GameState& state, GhostId id, GhostMode mode, GhostMode nextMode) const {
+        GhostActor& ghost = state.ghosts[id];
+        ghost.mode = mode;
+        ghost.nextMode = nextMode;
+        ghost.hasChaseTarget = false;
+
+        switch (mode) {
+            case GhostMode::Scatter:
+                ghost.strategy = rules_.getGhostTargetStrategy(state.level);
+                ghost.targetTile = ghostTraits[id].scatterTargetTile;
+                startGhostMovement(state, id);
+                break;
+            case GhostMode::Chase:
+                ghost.hasChaseTarget = true;
+                ghost.strategy = rules_.getGhostTargetStrategy(state.level);
+                ghost.targetTile = getChaseTarget(state, id);
+                startGhostMovement(state, id);
+                break;
+            case GhostMode::Frightened:
+                ghost.strategy = MoveStrategy::Random;
+                break;
+            case GhostMode::Eaten:
+                ghost.strategy = rules_.getGhostTargetStrategy(state.level);
+                ghost.targetTile = Constants::EATEN_GHOST_RESPAWN_TILE;
+                startGhostMovement(state, id);
+                break;
+            default:
+                break;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::emit(GameState& state, GameEvent event) const {
+        if (state.phase == GamePhase::LevelComplete)
+            return;
+
+        for (int i = 0; i < GhostCount; i++)
+            handleGhostEvent(state, static_cast<GhostId>(i), event);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::handleGhostEvent(GameState& state, GhostId id, GameEvent event) const {
+        GhostActor& ghost = state.ghosts[id];
+
+        switch (ghost.mode) {
+            case GhostMode::Idle:
+                if (event == GameEvent::ScatterModeBegin)
+                    setGhostMode(state, id, GhostMode::Scatter);
+                break;
+            case GhostMode::Scatter:
+            case GhostMode::Chase:
+                // Reverse direction
+                if (event == GameEvent::ScatterModeBegin || event == GameEvent::FrightenedModeBegin) {
+                    if (!ghost.isLocked && ghost.mover.tile != Constants::EATEN_GHOST_RESPAWN_TILE)
+                        ghost.mover.direction = reverseDir(ghost.mover.direction);
+                }
+
+                if (event == GameEvent::FrightenedModeBegin)
+                    setGhostMode(state, id, GhostMode::Frightened, ghost.mode);
+                else if (event == GameEvent::ChaseModeBegin && ghost.mode == GhostMode::Scatter)
+                    setGhostMode(state, id, GhostMode::Chase);
+                else if (event == GameEvent::ScatterModeBegin && ghost.mode == GhostMode::Chase)
+                    setGhostMode(state, id, GhostMode::Scatter);
+                break;
+            case GhostMode::Frightened:
+                if (event == GameEvent::FrightenedModeEnd)
+                    setGhostMode(state, id, ghost.nextMode);
+                else if (event == GameEvent::GhostEaten)
+                    setGhostMode(state, id, GhostMode::Eaten, ghost.nextMode);
+                break;
+            case GhostMode::Eaten:
+                if (event == GameEvent::ChaseModeEnd)
+                    ghost.nextMode = GhostMode::Scatter;
+                else if (event == GameEvent::ScatterModeEnd)
+                    ghost.nextMode = GhostMode::Chase;
+                break;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::resolveGhostCollision(GameState& state, GhostId id) const {
+        GhostActor& ghost = state.ghosts[id];
+
+        // Prevent pacman from being killed while dying - Happens when at
+        // least two ghosts enters pacmans tile at the same time
+        if (state.pacman.mode == PacManMode::Dying)
+            return;
+
+        if (ghost.mode == GhostMode::Frightened) {
+            updateScore(state, Constants::Points::GHOST * state.pointsMultiplier);
+            setMovementFreeze(state, true);
+            state.pointsMultiplier = state.pointsMultiplier == 8 ? 1 : state.pointsMultiplier * 2;
+            state.timers.pauseAll(GHOST_CAUGHT_FROZEN_TIMERS);
+            state.timers.start(EatenDelayTimer + id, toTicks(Constants::ACTOR_FREEZE_DURATION));
+        } else if (ghost.mode != GhostMode::Eaten)
+            killPacMan(state);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::eatPellet(GameState& state) const {
+        const TileIndex& tile = state.pacman.mover.tile;
+        state.removePellet(maze_.toTileId(tile.row, tile.colm));
+        state.remainingPelletCount -= 1;
+        state.eatenPelletCount += 1;
+
+        if (maze_.isEnergizer(tile.row, tile.colm)) {
+            updateScore(state, Constants::Points::ENERGIZER);
+            startGhostFrightenedMode(state);
+        } else
+            updateScore(state, Constants::Points::DOT);
+
+        if (state.eatenPelletCount == Constants::FIRST_FRUIT_APPEARANCE_PELLET_COUNT ||
+            state.eatenPelletCount == Constants::SECOND_FRUIT_APPEARANCE_PELLET_COUNT)
+        {
+            state.fruit.isActive = true;
+            state.fruit.type = rules_.getFruitType(state.level);
+            state.timers.start(UneatenFruitTimer, toTicks(Constants::UNEATEN_FRUIT_DESTRUCTION_DELAY));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::updateScore(GameState& state, int points) const {
+        state.score += points;
+
+        if ((state.score >= Constants::FIRST_EXTRA_LIFE_MIN_SCORE && state.extraLivesGiven == 0) ||
+            (state.score >= Constants::SECOND_EXTRA_LIFE_MIN_SCORE && state.extraLivesGiven == 1))
+        {
+            state.extraLivesGiven++;
+            state.pacman.lives++;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::setMovementFreeze(GameState& state, bool freeze) const {
+        state.pacman.mover.isFrozen = freeze;
+
+        for (GhostActor& ghost : state.ghosts) {
+            if (ghost.mode == GhostMode::Eaten && freeze)
+                continue;
+
+            ghost.mover.isFrozen = freeze;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::startGhostFrightenedMode(GameState& state) const {
+        std::uint64_t duration = toTicks(rules_.getFrightenedModeDuration(state.level));
+
+        if (state.timers.isRunning(FrightenedModeTimer))
+            state.timers.extend(FrightenedModeTimer, duration);
+        else {
+            if (state.timers.isRunning(ScatterModeTimer))
+                state.timers.pause(ScatterModeTimer);
+            else if (state.timers.isRunning(ChaseModeTimer))
+                state.timers.pause(ChaseModeTimer);
+            else {
+                assert(false && "Ghost entered frightened mode from an invalid state: valid states are scatter and chase");
+            }
+
+            state.timers.start(FrightenedModeTimer, duration);
+            emit(state, GameEvent::FrightenedModeBegin);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::startGhostScatterMode(GameState& state) const {
+        if (state.timers.isPaused(ScatterModeTimer)) {
+            state.timers.resume(ScatterModeTimer);
+            return;
+        }
+
+        state.scatterWave += 1;
+        state.timers.start(ScatterModeTimer, toTicks(rules_.getScatterModeDuration(state.level, state.scatterWave)));
+        emit(state, GameEvent::ScatterModeBegin);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::startGhostChaseMode(GameState& state) const {
+        if (state.timers.isPaused(ChaseModeTimer)) {
+            state.timers.resume(ChaseModeTimer);
+            return;
+        }
+
+        state.chaseWave += 1;
+        state.timers.start(ChaseModeTimer, toTicks(rules_.getChaseModeDuration(state.level, state.chaseWave)));
+        emit(state, GameEvent::ChaseModeBegin);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::updateTimers(GameState& state) const {
+        state.timers.advance();
+
+        for (int timer = state.timers.popExpired(); timer != -1; timer = state.timers.popExpired()) {
+            switch (timer) {
+                case GhostHouseTimer:
+                    if (state.ghostsInHouse == 3) { // Release pinky
+                        state.ghosts[Pinky].isLocked = false;
+                        state.timers.start(GhostHouseTimer, toTicks(Constants::INKY_HOUSE_ARREST_DURATION));
+                    } else if (state.ghostsInHouse == 2) { // Release inky
+                        state.ghosts[Inky].isLocked = false;
+                        state.timers.start(GhostHouseTimer, toTicks(Constants::CLYDE_HOUSE_ARREST_DURATION));
+                    } else // Release clyde
+                        state.ghosts[Clyde].isLocked = false;
+
+                    state.ghostsInHouse -= 1;
+                    break;
+                case ChaseModeTimer:
+                    if (state.chaseWave != 4) {
+                        emit(state, GameEvent::ChaseModeEnd);
+                        startGhostScatterMode(state);
+                    }
+                    break;
+                case ScatterModeTimer:
+                    emit(state, GameEvent::ScatterModeEnd);
+                    startGhostChaseMode(state);
+                    break;
+                case FrightenedModeTimer:
+                    state.pointsMultiplier = 1;
+                    emit(state, GameEvent::FrightenedModeEnd);
+
+                    // A paused timer implies that the ghost was in the state
+                    // controlled by the timer before being frightened
+                    if (state.timers.isPaused(ScatterModeTimer))
+                        startGhostScatterMode(state);
+                    else if (state.timers.isPaused(ChaseModeTimer))
+                        startGhostChaseMode(state);
+                    else {
+                        if (state.random.nextInt(1, 100) >= 50)
+                            startGhostChaseMode(state);
+                        else
+                            startGhostScatterMode(state);
+                    }
+                    break;
+                case UneatenFruitTimer:
+                    state.fruit.isActive = false;
+                    break;
+                case PhaseTimer:
+                    endPhase(state);
+                    break;
+                default: // The eaten delay of a ghost
+                    setMovementFreeze(state, false);
+                    state.timers.resumeAll(GHOST_CAUGHT_FROZEN_TIMERS);
+                    handleGhostEvent(state, static_cast<GhostId>(timer - EatenDelayTimer), GameEvent::GhostEaten);
+                    break;
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::stopTimers(GameState& state) const {
+        state.timers.stopAll(GAMEPLAY_TIMERS);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::killPacMan(GameState& state) const {
+        state.pacman.mode = PacManMode::Dying;
+        state.pacman.lives -= 1;
+        state.deaths += 1;
+        state.fruit.isActive = false;
+        stopTimers(state);
+
+        state.pacman.mover.isFrozen = true;
+        for (GhostActor& ghost : state.ghosts)
+            ghost.mover.isFrozen = true;
+
+        state.phase = GamePhase::PacManDying;
+        state.timers.start(PhaseTimer, toTicks(PACMAN_DEATH_DURATION));
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Simulation::completeLevel(GameState& state) const {
+        stopTimers(state);
+        state.fruit.isActive = false;
+        state.pacman.mover.isFrozen = true;
+
+        state.timers.stopAll(EATEN_DELAY_TIMERS);
+        state.phase = GamePhase::LevelComplete;
+        state.timers.start(PhaseTimer, toTicks(LEVEL_COMPLETE_DURATION));
+    }
+
+} // namespace pm
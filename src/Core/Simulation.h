@@ -0,0 +1,357 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_SIMULATION_H
+#define PACMAN_SIMULATION_H
+
+#include "Core/GameState.h"
+#include "Core/Maze.h"
+#include "Common/GameEvents.h"
+#include <cstdint>
+
+namespace pm {
+    class LevelRules;
+
+    /**
+     * @brief Advances a game by applying the gameplay rules to a game state
+     *
+     * The simulation holds the gameplay rules of the game, pm::GameplayScene
+     * only presents the game states it advances. It does not depend on
+     * the engine: there is no window, no rendering,
+     * no audio and no wall clock. Time only passes when step() is called,
+     * so a game can be advanced as fast as the CPU allows and two games
+     * with the same seed and input always play out the same way
+     *
+     * The simulation does not hold any game state, the same simulation
+     * can advance any number of game states that were reset with it
+     */
+    class Simulation {
+    public:
+        static constexpr float TIMESTEP = 1.0f / 120.0f;   //!< The fixed time (in seconds) of a tick, the default length of a step
+        static constexpr unsigned int MAX_STEP_TICKS = 120; //!< The most ticks of TIMESTEP a single step may cover
+
+        /**
+         * @brief Constructor
+         * @param maze The maze the games are played in
+         * @param rules The speeds, durations and fruits of each level
+         *
+         * @warning The maze and the rules must outlive the simulation
+         */
+        Simulation(const Maze& maze, const LevelRules& rules);
+
+        /**
+         * @brief Start a new game
+         * @param state The state to start the game in
+         * @param seed The seed of the game
+         *
+         * The game starts at level 1 with the level start countdown
+         */
+        void reset(GameState& state, std::uint64_t seed) const;
+
+        /**
+         * @brief Advance a game
+         * @param state The state of the game to be advanced
+         * @param input The direction the player pressed in this step, or
+         *              Dir::None if no direction was pressed
+         * @param dt The time (in seconds) to advance the game by, it is
+         *           rounded to a whole number of ticks of TIMESTEP (at
+         *           least one and at most MAX_STEP_TICKS)
+         *
+         * A @a dt that is NaN or rounds to less than one tick advances the
+         * game by one tick. A @a dt longer than MAX_STEP_TICKS ticks is cut
+         * to MAX_STEP_TICKS, the rest of the time is not simulated, so a
+         * caller that falls further behind must step more than once
+         *
+         * A step of several ticks plays out exactly like a step with
+         * @a input followed by steps without input for the remaining
+         * ticks: the actors cannot pass through each other however coarse
+         * the step is. Only the ticks in which an actor reaches a tile or
+         * a timer expires are resolved in full, the others merely move
+         * the actors and count down the timers. The game stops in the
+         * tick it ends in, a game that is over is not advanced
+         */
+        void step(GameState& state, Dir input, float dt = TIMESTEP) const;
+
+        /**
+         * @brief Advance a game by several steps with the same input
+         * @param state The state of the game to be advanced
+         * @param input The direction the player holds during the steps, or
+         *              Dir::None if no direction is pressed
+         * @param tickCount The number of steps of TIMESTEP to advance the game by
+         * @return The number of steps made, which is less than @a tickCount
+         *         if the game ended on the way
+         *
+         * This is the same as calling step @a tickCount times, so the game
+         * plays out exactly as if the input was pressed every step. Callers
+         * that only act every few steps read the state once at the end and
+         * measure rewards as the difference over the whole call
+         */
+        unsigned int advance(GameState& state, Dir input, unsigned int tickCount) const;
+
+        /**
+         * @brief Start the current level of a game
+         * @param state The state of the game
+         *
+         * The pellets, the actors and the timers are reset for the level
+         * in state.level. The score, the lives and the other values that
+         * carry over from level to level are kept, so a frontend that plays
+         * one level at a time (see pm::GameplayScene) can start any level
+         * of a game it keeps on its own
+         */
+        void startLevel(GameState& state) const;
+
+    private:
+        /**
+         * @brief Place pacman and the ghosts on their spawn tiles
+         * @param state The state of the game
+         */
+        void resetActors(GameState& state) const;
+
+        /**
+         * @brief Start the level start countdown
+         * @param state The state of the game
+         */
+        void startCountDown(GameState& state) const;
+
+        /**
+         * @brief Advance the current phase of the game when its timer expires
+         * @param state The state of the game
+         */
+        void endPhase(GameState& state) const;
+
+        /**
+         * @brief Turn pacman in the direction pressed by the player
+         * @param state The state of the game
+         * @param dir The direction pressed by the player
+         */
+        void handleInput(GameState& state, Dir dir) const;
+
+        /**
+         * @brief Advance a game by a tick and resolve what happened in it
+         * @param state The state of the game
+         */
+        void updateTick(GameState& state) const;
+
+        /**
+         * @brief Get the number of ticks in which nothing but movement and
+         *        the countdown of the timers happens
+         * @param state The state of the game
+         * @param maxTicks The most ticks to look ahead
+         * @return The number of ticks before the next tick in which an
+         *         actor reaches a tile or a timer expires, at most @a maxTicks
+         */
+        unsigned int getQuietTickCount(const GameState& state, unsigned int maxTicks) const;
+
+        /**
+         * @brief Advance a game by ticks that getQuietTickCount() returned
+         * @param state The state of the game
+         * @param tickCount The number of ticks to skip
+         */
+        void skipQuietTicks(GameState& state, unsigned int tickCount) const;
+
+        /**
+         * @brief Move an actor towards the tile it is moving to by a tick
+         * @param mover The actor to be moved
+         * @param speed The speed of the actor in pixels per second
+         * @return True if the actor reached the tile, otherwise false
+         */
+        bool advanceMover(MoverState& mover, float speed) const;
+
+        /**
+         * @brief Get the number of ticks an actor needs to reach the tile
+         *        it is moving to
+         * @param mover The actor
+         * @param speed The speed of the actor in pixels per second
+         * @param maxTicks The most ticks to look ahead
+         * @return The tick (starting at 1) in which the actor reaches the
+         *         tile, or 0 if it does not reach it within @a maxTicks
+         */
+        unsigned int getTicksToTile(const MoverState& mover, float speed, unsigned int maxTicks) const;
+
+        /**
+         * @brief Start moving an actor to an adjacent tile
+         * @param mover The actor to be moved
+         * @param dir The direction to move the actor in
+         * @param isRestricted True if the actor is not allowed to move
+         *
+         * The request is ignored if the actor is already moving or if the
+         * adjacent tile is a wall (see ime::GridMover::requestMove)
+         */
+        void requestMove(MoverState& mover, Dir dir, bool isRestricted) const;
+
+        /**
+         * @brief Move an actor that entered a teleportation sensor to the
+         *        other end of the row
+         * @param mover The actor to be teleported
+         * @param isRestricted True if the actor is not allowed to move
+         */
+        void teleport(MoverState& mover, bool isRestricted) const;
+
+        /**
+         * @brief Check if pacman can move in a direction from his tile
+         * @param state The state of the game
+         * @param dir The direction to be checked
+         * @return True if pacman can move in the direction, otherwise false
+         */
+        bool isOpenForPacMan(const GameState& state, Dir dir) const;
+
+        /**
+         * @brief Resolve pacman arriving at a tile
+         * @param state The state of the game
+         */
+        void onPacManMoveEnd(GameState& state) const;
+
+        /**
+         * @brief Resolve a ghost arriving at a tile
+         * @param state The state of the game
+         * @param id The ghost that arrived
+         */
+        void onGhostMoveEnd(GameState& state, GhostId id) const;
+
+        /**
+         * @brief Choose the next tile of a ghost
+         * @param state The state of the game
+         * @param id The ghost to be moved
+         */
+        void moveGhost(GameState& state, GhostId id) const;
+
+        /**
+         * @brief Start moving a ghost that has not moved since it was placed
+         *        on its spawn tile
+         * @param state The state of the game
+         * @param id The ghost to be moved
+         */
+        void startGhostMovement(GameState& state, GhostId id) const;
+
+        /**
+         * @brief Get the tile a ghost targets when in chase mode
+         * @param state The state of the game
+         * @param id The ghost whose target is needed
+         * @return The chase target of the ghost
+         */
+        TileIndex getChaseTarget(const GameState& state, GhostId id) const;
+
+        /**
+         * @brief Make a ghost enter a state
+         * @param state The state of the game
+         * @param id The ghost whose state is changed
+         * @param mode The state to enter
+         * @param nextMode The state to return to after being frightened or eaten
+         */
+        void setGhostMode(GameState& state, GhostId id, GhostMode mode, GhostMode nextMode = GhostMode::Scatter) const;
+
+        /**
+         * @brief Notify the ghosts of a game event
+         * @param state The state of the game
+         * @param event The event that took place
+         */
+        void emit(GameState& state, GameEvent event) const;
+
+        /**
+         * @brief Make a ghost react to a game event
+         * @param state The state of the game
+         * @param id The ghost that is notified
+         * @param event The event that took place
+         */
+        void handleGhostEvent(GameState& state, GhostId id, GameEvent event) const;
+
+        /**
+         * @brief Resolve pacman and a ghost occupying the same tile
+         * @param state The state of the game
+         * @param id The ghost that collided with pacman
+         */
+        void resolveGhostCollision(GameState& state, GhostId id) const;
+
+        /**
+         * @brief Eat the pellet on pacman's tile
+         * @param state The state of the game
+         */
+        void eatPellet(GameState& state) const;
+
+        /**
+         * @brief Add points to the score and award extra lives
+         * @param state The state of the game
+         * @param points The points to add
+         */
+        void updateScore(GameState& state, int points) const;
+
+        /**
+         * @brief Freeze or unfreeze the movement of pacman and the ghosts
+         * @param state The state of the game
+         * @param freeze True to freeze or false to unfreeze
+         *
+         * Eaten ghosts are never frozen
+         */
+        void setMovementFreeze(GameState& state, bool freeze) const;
+
+        /**
+         * @brief Start or extend the ghost frightened mode
+         * @param state The state of the game
+         */
+        void startGhostFrightenedMode(GameState& state) const;
+
+        /**
+         * @brief Start or resume the ghost scatter mode
+         * @param state The state of the game
+         */
+        void startGhostScatterMode(GameState& state) const;
+
+        /**
+         * @brief Start or resume the ghost chase mode
+         * @param state The state of the game
+         */
+        void startGhostChaseMode(GameState& state) const;
+
+        /**
+         * @brief Advance the timers of the game by a step and handle the
+         *        ones that expired
+         * @param state The state of the game
+         */
+        void updateTimers(GameState& state) const;
+
+        /**
+         * @brief Stop the ghost mode, ghost house and fruit timers
+         * @param state The state of the game
+         */
+        void stopTimers(GameState& state) const;
+
+        /**
+         * @brief Kill pacman
+         * @param state The state of the game
+         */
+        void killPacMan(GameState& state) const;
+
+        /**
+         * @brief Freeze the game after the last pellet is eaten
+         * @param state The state of the game
+         */
+        void completeLevel(GameState& state) const;
+
+    private:
+        const Maze& maze_;        //!< The maze the games are played in
+        const LevelRules& rules_; //!< The speeds, durations and fruits of each level
+    };
+}
+
+#endif //PACMAN_SIMULATION_H
@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Snapshot.h"
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace pm {
+    namespace {
+        const char MAGIC[] = {'P', 'M', 'S', 'S'};
+        const std::uint32_t VERSION = 2;
+
+        void writeUint32(std::vector<std::uint8_t>& buffer, std::uint32_t value) {
+            for (int i = 0; i < 4; i++)
+                buffer.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+        }
+
+        std::uint32_t readUint32(const std::uint8_t* data) {
+            std::uint32_t value = 0;
+            for (int i = 0; i < 4; i++)
+                value |= static_cast<std::uint32_t>(data[i]) << (i * 8);
+
+            return value;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    Snapshot::Snapshot() :
+        isEmpty_{true}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    void Snapshot::capture(const GameState& state) {
+        state_ = state;
+        isEmpty_ = false;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Snapshot::restore(GameState& state) const {
+        assert(!isEmpty_ && "Cannot restore an empty snapshot");
+        state = state_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool Snapshot::isEmpty() const {
+        return isEmpty_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const GameState& Snapshot::getState() const {
+        return state_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Snapshot::serialize(std::vector<std::uint8_t>& buffer) const {
+        assert(!isEmpty_ && "Cannot serialize an empty snapshot");
+
+        buffer.reserve(buffer.size() + SERIALIZED_SIZE);
+        buffer.insert(buffer.end(), std::begin(MAGIC), std::end(MAGIC));
+        writeUint32(buffer, VERSION);
+        writeUint32(buffer, static_cast<std::uint32_t>(sizeof(GameState)));
+
+        auto bytes = reinterpret_cast<const std::uint8_t*>(&state_);
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(GameState));
+        writeUint32(buffer, computeStateHash(state_));
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool Snapshot::deserialize(const std::uint8_t* data, std::size_t size) {
+        if (size < SERIALIZED_SIZE || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0
+            || readUint32(data + 4) != VERSION || readUint32(data + 8) != sizeof(GameState))
+        {
+            return false;
+        }
+
+        // The hash rejects corrupted files before the state is used
+        GameState state;
+        std::memcpy(&state, data + 12, sizeof(GameState));
+        if (computeStateHash(state) != readUint32(data + 12 + sizeof(GameState)))
+            return false;
+
+        capture(state);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool Snapshot::saveToFile(const std::string& filename) const {
+        std::vector<std::uint8_t> buffer;
+        serialize(buffer);
+
+        std::ofstream file(filename, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        return static_cast<bool>(file);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool Snapshot::loadFromFile(const std::string& filename) {
+        std::ifstream file(filename, std::ios::binary);
+        if (!file)
+            return false;
+
+        std::vector<std::uint8_t> buffer{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+        return buffer.size() == SERIALIZED_SIZE && deserialize(buffer.data(), buffer.size());
+    }
+
+} // namespace pm
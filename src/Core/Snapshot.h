@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_SNAPSHOT_H
+#define PACMAN_SNAPSHOT_H
+
+#include "Core/GameState.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace pm {
+    /**
+     * @brief A copy of a game state that can be restored later
+     *
+     * pm::GameState holds everything a running game depends on, the
+     * actors, their movement progress and modes, the five gameplay timers,
+     * the pellets and the score. Since it is trivially copyable, capturing
+     * and restoring a snapshot is a single copy of a few hundred bytes
+     *
+     * A serialized snapshot is the raw state followed by its hash, which
+     * is verified when it is read back. The raw layout depends on the
+     * build, so snapshots are meant to be read by the same executable that
+     * wrote them (for example to resume a game after a crash), and they
+     * must be restored into a game that plays the same maze
+     */
+    class Snapshot {
+    public:
+        static constexpr std::size_t SERIALIZED_SIZE = 12 + sizeof(GameState) + 4; //!< The number of bytes written by serialize
+
+        /**
+         * @brief Constructor
+         *
+         * The snapshot is empty until a state is captured
+         */
+        Snapshot();
+
+        /**
+         * @brief Capture a game state
+         * @param state The state to be captured
+         */
+        void capture(const GameState& state);
+
+        /**
+         * @brief Restore the captured state
+         * @param state The state to overwrite with the captured one
+         *
+         * The snapshot must not be empty
+         */
+        void restore(GameState& state) const;
+
+        /**
+         * @brief Check if a state has been captured
+         * @return True if no state has been captured, otherwise false
+         */
+        bool isEmpty() const;
+
+        /**
+         * @brief Get the captured state
+         * @return The captured state
+         */
+        const GameState& getState() const;
+
+        /**
+         * @brief Append the snapshot to a buffer
+         * @param buffer The buffer to append SERIALIZED_SIZE bytes to
+         *
+         * The snapshot must not be empty
+         */
+        void serialize(std::vector<std::uint8_t>& buffer) const;
+
+        /**
+         * @brief Read a snapshot written by serialize
+         * @param data The serialized snapshot
+         * @param size The number of bytes available at @a data
+         * @return True if the snapshot was read, or false if @a data does
+         *         not hold a valid snapshot. The snapshot is left unchanged
+         *         on failure
+         */
+        bool deserialize(const std::uint8_t* data, std::size_t size);
+
+        /**
+         * @brief Save the snapshot to a file
+         * @param filename The name of the file to save the snapshot to
+         * @return True if the snapshot was saved, otherwise false
+         */
+        bool saveToFile(const std::string& filename) const;
+
+        /**
+         * @brief Load the snapshot from a file
+         * @param filename The name of the file that contains the snapshot
+         * @return True if the snapshot was loaded, otherwise false
+         */
+        bool loadFromFile(const std::string& filename);
+
+    private:
+        GameState state_; //!< The captured state
+        bool isEmpty_;    //!< A flag indicating whether a state has been captured or not
+    };
+}
+
+#endif //PACMAN_SNAPSHOT_H
@@ -0,0 +1,204 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "TimerWheel.h"
+#include <cassert>
+
+namespace pm {
+    namespace {
+        const int SLOT_BITS = 6;
+        const std::uint64_t SLOT_MASK = 63;
+
+        // Index of the lowest set bit of a non-zero mask
+        int lowestBit(std::uint16_t mask) {
+            int bit = 0;
+            while (!(mask & 1u)) {
+                mask >>= 1;
+                bit++;
+            }
+
+            return bit;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::start(int id, std::uint64_t duration) {
+        assert(id >= 0 && id < CAPACITY && "Timer id out of range");
+        assert(duration > 0 && duration <= MAX_DURATION && "Timer duration out of range");
+
+        stop(id);
+        deadlines_[id] = now_ + duration;
+        status_[id] = Status::Running;
+        insert(id);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::extend(int id, std::uint64_t duration) {
+        if (status_[id] == Status::Paused)
+            deadlines_[id] += duration;
+        else if (status_[id] == Status::Running) {
+            remove(id);
+            deadlines_[id] += duration;
+            insert(id);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::stop(int id) {
+        if (status_[id] == Status::Running)
+            remove(id);
+
+        deadlines_[id] = 0;
+        status_[id] = Status::Stopped;
+        expired_ &= static_cast<std::uint16_t>(~mask(id));
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::stopAll(std::uint16_t timers) {
+        for (; timers; timers &= static_cast<std::uint16_t>(timers - 1))
+            stop(lowestBit(timers));
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::pause(int id) {
+        if (status_[id] != Status::Running)
+            return;
+
+        remove(id);
+        deadlines_[id] -= now_;
+        status_[id] = Status::Paused;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::pauseAll(std::uint16_t timers) {
+        for (; timers; timers &= static_cast<std::uint16_t>(timers - 1))
+            pause(lowestBit(timers));
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::resume(int id) {
+        if (status_[id] != Status::Paused)
+            return;
+
+        deadlines_[id] += now_;
+        status_[id] = Status::Running;
+        insert(id);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::resumeAll(std::uint16_t timers) {
+        for (; timers; timers &= static_cast<std::uint16_t>(timers - 1))
+            resume(lowestBit(timers));
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::advance() {
+        now_++;
+        expired_ = 0;
+
+        // When the finest level wraps around, the slots of the coarser
+        // levels that the wheel just reached are spread over the finer
+        // levels, starting with the coarsest one
+        int cascadeLevel = 0;
+        while (cascadeLevel + 1 < LEVEL_COUNT && (now_ & ((std::uint64_t{1} << (SLOT_BITS * (cascadeLevel + 1))) - 1)) == 0)
+            cascadeLevel++;
+
+        for (int level = cascadeLevel; level > 0; level--) {
+            std::uint16_t& slot = slots_[level][(now_ >> (SLOT_BITS * level)) & SLOT_MASK];
+            std::uint16_t timers = slot;
+            slot = 0;
+
+            for (; timers; timers &= static_cast<std::uint16_t>(timers - 1))
+                insert(lowestBit(timers));
+        }
+
+        std::uint16_t& slot = slots_[0][now_ & SLOT_MASK];
+        expired_ = slot;
+        slot = 0;
+
+        for (std::uint16_t timers = expired_; timers; timers &= static_cast<std::uint16_t>(timers - 1)) {
+            int id = lowestBit(timers);
+            assert(deadlines_[id] == now_ && "A timer expired at the wrong step");
+            deadlines_[id] = 0;
+            status_[id] = Status::Stopped;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int TimerWheel::popExpired() {
+        if (!expired_)
+            return -1;
+
+        int id = lowestBit(expired_);
+        expired_ &= static_cast<std::uint16_t>(expired_ - 1);
+        return id;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::uint64_t TimerWheel::getRemaining(int id) const {
+        switch (status_[id]) {
+            case Status::Running:
+                return deadlines_[id] - now_;
+            case Status::Paused:
+                return deadlines_[id];
+            default:
+                return 0;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::uint64_t TimerWheel::getNextExpiry() const {
+        std::uint64_t deadline = 0;
+
+        for (int id = 0; id < CAPACITY; id++) {
+            if (status_[id] == Status::Running && (deadline == 0 || deadlines_[id] < deadline))
+                deadline = deadlines_[id];
+        }
+
+        return deadline == 0 ? 0 : deadline - now_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::insert(int id) {
+        // A timer goes to the finest level on which its deadline and the
+        // current step only differ in that level's slot. Deadlines past
+        // the range of the coarsest level wrap around it
+        std::uint64_t deadline = deadlines_[id];
+        std::uint64_t difference = deadline ^ now_;
+        int level = 0;
+
+        while (level + 1 < LEVEL_COUNT && (difference >> (SLOT_BITS * (level + 1))) != 0)
+            level++;
+
+        auto slot = static_cast<std::uint16_t>(level * 64 + ((deadline >> (SLOT_BITS * level)) & SLOT_MASK));
+        slots_[level][slot & SLOT_MASK] |= mask(id);
+        slotOf_[id] = slot;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void TimerWheel::remove(int id) {
+        slots_[slotOf_[id] / 64][slotOf_[id] & SLOT_MASK] &= static_cast<std::uint16_t>(~mask(id));
+    }
+
+} // namespace pm
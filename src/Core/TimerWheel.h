@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_TIMERWHEEL_H
+#define PACMAN_TIMERWHEEL_H
+
+#include <cstdint>
+
+namespace pm {
+    /**
+     * @brief Counts down a fixed set of timers in simulation steps
+     *
+     * Timers are identified by a number below CAPACITY that the owner
+     * assigns a meaning to, and sets of timers are passed as bit masks of
+     * those numbers (see mask()). Unlike ime::Timer, a timer does not hold
+     * a callback: after advance() the owner pops the timers that expired
+     * with popExpired() and reacts to them itself. Timers that expire in the
+     * same step are popped in ascending id order, so the order in which a
+     * game reacts to them never depends on when they were started
+     *
+     * The pending timers are kept in a hierarchical timing wheel of
+     * LEVEL_COUNT levels of 64 slots, where each slot is a bit mask of the
+     * timers that expire within it. A timer is moved to a finer level
+     * only when the wheel reaches its slot, which makes advancing by a
+     * step O(1) however many timers are pending. The wheel is plain data,
+     * so it is copied along with the state that owns it
+     */
+    class TimerWheel {
+    public:
+        static constexpr int CAPACITY = 16;                                             //!< The maximum number of timers
+        static constexpr int LEVEL_COUNT = 5;                                           //!< The number of levels in the wheel
+        static constexpr std::uint64_t MAX_DURATION = std::uint64_t{1} << (6 * LEVEL_COUNT - 1); //!< The longest duration (in steps) a timer can be started with
+
+        /**
+         * @brief Get the mask of a timer
+         * @param id The id of the timer
+         * @return The bit that represents the timer in a timer set
+         */
+        static constexpr std::uint16_t mask(int id) {
+            return static_cast<std::uint16_t>(1u << id);
+        }
+
+        /**
+         * @brief Start a timer
+         * @param id The id of the timer
+         * @param duration The number of steps before the timer expires, at least 1
+         *
+         * A timer that is running or paused is restarted
+         */
+        void start(int id, std::uint64_t duration);
+
+        /**
+         * @brief Add time to a running or paused timer
+         * @param id The id of the timer
+         * @param duration The number of steps to add
+         */
+        void extend(int id, std::uint64_t duration);
+
+        /**
+         * @brief Stop a timer without it expiring
+         * @param id The id of the timer
+         */
+        void stop(int id);
+
+        /**
+         * @brief Stop a set of timers
+         * @param timers The mask of the timers to be stopped
+         */
+        void stopAll(std::uint16_t timers);
+
+        /**
+         * @brief Stop a running timer from counting down without losing its remaining duration
+         * @param id The id of the timer
+         *
+         * Timers that are not running are ignored, including a timer that
+         * expired in the last step but was not popped yet
+         */
+        void pause(int id);
+
+        /**
+         * @brief Pause a set of timers
+         * @param timers The mask of the timers to be paused, timers that are not running are ignored
+         */
+        void pauseAll(std::uint16_t timers);
+
+        /**
+         * @brief Continue counting down a paused timer
+         * @param id The id of the timer
+         */
+        void resume(int id);
+
+        /**
+         * @brief Resume a set of timers
+         * @param timers The mask of the timers to be resumed, timers that are not paused are ignored
+         */
+        void resumeAll(std::uint16_t timers);
+
+        /**
+         * @brief Advance the wheel by one step
+         *
+         * The timers that expire in this step are stopped and can be
+         * retrieved with popExpired()
+         */
+        void advance();
+
+        /**
+         * @brief Take the next timer that expired in the last step
+         * @return The id of the timer, or -1 if there are no more
+         *
+         * A timer that is started or stopped before it is popped is no
+         * longer reported. Pausing it has no effect: the timer already
+         * expired, so it is still reported
+         */
+        int popExpired();
+
+        /**
+         * @brief Check if a timer is counting down
+         * @param id The id of the timer
+         * @return True if the timer is running, otherwise false
+         */
+        bool isRunning(int id) const {
+            return status_[id] == Status::Running;
+        }
+
+        /**
+         * @brief Check if a timer is paused
+         * @param id The id of the timer
+         * @return True if the timer is paused, otherwise false
+         */
+        bool isPaused(int id) const {
+            return status_[id] == Status::Paused;
+        }
+
+        /**
+         * @brief Get the number of steps before a timer expires
+         * @param id The id of the timer
+         * @return The remaining steps of a running or paused timer, otherwise 0
+         */
+        std::uint64_t getRemaining(int id) const;
+
+        /**
+         * @brief Get the number of steps before the next running timer expires
+         * @return The remaining steps of the running timer that expires
+         *         first, or 0 if no timer is running
+         */
+        std::uint64_t getNextExpiry() const;
+
+        /**
+         * @brief Get the number of steps the wheel was advanced by
+         * @return The current step of the wheel
+         */
+        std::uint64_t getTick() const {
+            return now_;
+        }
+
+    private:
+        /**
+         * @brief The states of a timer
+         */
+        enum class Status : std::uint8_t {
+            Stopped, //!< The timer is not counting down
+            Running, //!< The timer is in the wheel
+            Paused   //!< The timer is out of the wheel but kept its remaining duration
+        };
+
+        /**
+         * @brief Place a running timer in the slot of its deadline
+         * @param id The id of the timer
+         */
+        void insert(int id);
+
+        /**
+         * @brief Take a running timer out of its slot
+         * @param id The id of the timer
+         */
+        void remove(int id);
+
+    private:
+        std::uint64_t now_ = 0;                            //!< The number of steps the wheel was advanced by
+        std::uint64_t deadlines_[CAPACITY] = {};           //!< The step a running timer expires at, or the remaining steps of a paused timer
+        std::uint16_t slots_[LEVEL_COUNT][64] = {};        //!< The timers in each slot of each level
+        std::uint16_t slotOf_[CAPACITY] = {};              //!< The level * 64 + slot that holds a running timer
+        Status status_[CAPACITY] = {};                     //!< The status of each timer
+        std::uint16_t expired_ = 0;                        //!< The timers that expired in the last step and were not popped yet
+    };
+}
+
+#endif //PACMAN_TIMERWHEEL_H
@@ -0,0 +1,145 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "PacmanEnv.h"
+#include "Env/VectorEnv.h"
+#include "Core/LevelRules.h"
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+
+struct pacman_env {
+    pm::Maze maze;
+    pm::LevelRules levelRules;
+    std::unique_ptr<pm::VectorEnv> vectorEnv;
+};
+
+///////////////////////////////////////////////////////////////
+pacman_env* pacman_env_create(int n_envs, uint64_t seed, int n_threads, const char* maze_dir) {
+    if (n_envs < 1 || n_threads < 0)
+        return nullptr;
+
+    auto env = std::unique_ptr<pacman_env>(new (std::nothrow) pacman_env());
+    if (!env)
+        return nullptr;
+
+    std::string mazeDir = maze_dir ? std::string(maze_dir) + "/" : "res/TextFiles/";
+    if (!env->maze.loadFromFile(mazeDir + "maze.txt", mazeDir + "maze_attributes.txt")
+        || !env->levelRules.loadFromFile(mazeDir + "level_profiles.txt"))
+        return nullptr;
+
+    unsigned int threadCount = n_threads > 0 ? static_cast<unsigned int>(n_threads) : std::thread::hardware_concurrency();
+    env->vectorEnv = std::make_unique<pm::VectorEnv>(env->maze, env->levelRules, static_cast<std::size_t>(n_envs), seed, threadCount);
+    return env.release();
+}
+
+///////////////////////////////////////////////////////////////
+int pacman_env_load_level_profiles(pacman_env* env, const char* filename) {
+    return filename && env->levelRules.loadFromFile(filename) ? 0 : -1;
+}
+
+///////////////////////////////////////////////////////////////
+void pacman_env_destroy(pacman_env* env) {
+    delete env;
+}
+
+///////////////////////////////////////////////////////////////
+int pacman_env_num_envs(const pacman_env* env) {
+    return static_cast<int>(env->vectorEnv->getEnvCount());
+}
+
+///////////////////////////////////////////////////////////////
+int pacman_env_observation_size(const pacman_env* env) {
+    return static_cast<int>(env->vectorEnv->getObservationSize());
+}
+
+///////////////////////////////////////////////////////////////
+int pacman_env_set_observation_type(pacman_env* env, int type) {
+    if (type == PACMAN_ENV_OBS_FEATURES)
+        env->vectorEnv->setObservationType(pm::VectorEnv::ObservationType::Features);
+    else if (type == PACMAN_ENV_OBS_PLANES)
+        env->vectorEnv->setObservationType(pm::VectorEnv::ObservationType::Planes);
+    else
+        return -1;
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////
+void pacman_env_plane_shape(const pacman_env* env, int* planes, int* rows, int* cols) {
+    if (planes)
+        *planes = pm::PlaneEncoder::PlaneCount;
+
+    if (rows)
+        *rows = env->maze.getRowCount();
+
+    if (cols)
+        *cols = env->maze.getColumnCount();
+}
+
+///////////////////////////////////////////////////////////////
+void pacman_env_set_buffers(pacman_env* env, float* observations, float* rewards, uint8_t* dones) {
+    env->vectorEnv->setBuffers(observations, rewards, dones);
+}
+
+///////////////////////////////////////////////////////////////
+void pacman_env_set_max_episode_ticks(pacman_env* env, uint64_t max_ticks) {
+    env->vectorEnv->setMaxEpisodeTicks(max_ticks);
+}
+
+///////////////////////////////////////////////////////////////
+int pacman_env_set_frame_skip(pacman_env* env, int frame_skip) {
+    if (frame_skip < 1)
+        return -1;
+
+    env->vectorEnv->setFrameSkip(static_cast<unsigned int>(frame_skip));
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////
+int pacman_env_reset(pacman_env* env) {
+    if (!env->vectorEnv->hasBuffers())
+        return -1;
+
+    env->vectorEnv->reset();
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////
+int pacman_env_step(pacman_env* env, const int32_t* actions) {
+    if (!env->vectorEnv->hasBuffers())
+        return -1;
+
+    env->vectorEnv->step(actions);
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////
+int pacman_env_episode_score(const pacman_env* env, int index) {
+    if (index < 0 || static_cast<std::size_t>(index) >= env->vectorEnv->getEnvCount())
+        return -1;
+
+    return env->vectorEnv->getEpisodeScore(static_cast<std::size_t>(index));
+}
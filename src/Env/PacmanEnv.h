@@ -0,0 +1,196 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_PACMANENV_H
+#define PACMAN_PACMANENV_H
+
+/*
+ * C interface of libpacman_env, a vector of headless Pac-Man games for
+ * training agents. It wraps pm::VectorEnv, see that class for how games
+ * are stepped and reset. The games are advanced by pm::Simulation, which
+ * also drives the playable game, so both always play by the same rules.
+ *
+ * Typical use:
+ *   pacman_env* env = pacman_env_create(64, 0, 4, "res/TextFiles");
+ *   pacman_env_set_buffers(env, observations, rewards, dones);
+ *   pacman_env_reset(env);
+ *   while (training)
+ *       pacman_env_step(env, actions);
+ *   pacman_env_destroy(env);
+ *
+ * The buffers are owned by the caller and are written in place. They must
+ * hold pacman_env_observation_size() floats per game for the observations,
+ * one float per game for the rewards and one byte per game for the dones.
+ */
+
+#include <stdint.h>
+
+#if defined(_WIN32)
+    #ifdef PACMAN_ENV_EXPORTS
+        #define PACMAN_ENV_API __declspec(dllexport)
+    #else
+        #define PACMAN_ENV_API __declspec(dllimport)
+    #endif
+#else
+    #define PACMAN_ENV_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Actions, one per game and step */
+#define PACMAN_ENV_ACTION_NONE  0
+#define PACMAN_ENV_ACTION_UP    1
+#define PACMAN_ENV_ACTION_LEFT  2
+#define PACMAN_ENV_ACTION_DOWN  3
+#define PACMAN_ENV_ACTION_RIGHT 4
+
+/* Observation types */
+#define PACMAN_ENV_OBS_FEATURES 0 /* Positions and flags of pacman and the ghosts, pellets left, lives and phase */
+#define PACMAN_ENV_OBS_PLANES   1 /* Maze sized 0/1 planes: walls, dots, energizers, pacman, 4 ghosts, frightened ghosts, fruit */
+
+typedef struct pacman_env pacman_env;
+
+/**
+ * @brief Create a vector of games
+ * @param n_envs The number of games, at least 1
+ * @param seed The seed of the first game, game n starts with seed + n
+ * @param n_threads The number of threads that step the games, 0 for one per core
+ * @param maze_dir The directory that contains maze.txt, maze_attributes.txt
+ *                 and level_profiles.txt, or NULL for res/TextFiles
+ * @return The games, or NULL if an argument is invalid or the maze or the
+ *         level profiles could not be loaded
+ */
+PACMAN_ENV_API pacman_env* pacman_env_create(int n_envs, uint64_t seed, int n_threads, const char* maze_dir);
+
+/**
+ * @brief Replace the per level speeds, durations and fruits of a vector of games
+ * @param env The games
+ * @param filename The level profiles file, see res/TextFiles/level_profiles.txt
+ * @return 0 on success, or -1 if the file could not be loaded
+ *
+ * The profiles default to level_profiles.txt in the maze directory the
+ * games were created with and only apply to the games of @a env. Like every other call on @a env, this must not
+ * run while pacman_env_step or pacman_env_reset runs on the same games
+ */
+PACMAN_ENV_API int pacman_env_load_level_profiles(pacman_env* env, const char* filename);
+
+/**
+ * @brief Destroy a vector of games created by pacman_env_create
+ * @param env The games to destroy, may be NULL
+ */
+PACMAN_ENV_API void pacman_env_destroy(pacman_env* env);
+
+/**
+ * @brief Get the number of games
+ * @param env The games
+ * @return The number of games
+ */
+PACMAN_ENV_API int pacman_env_num_envs(const pacman_env* env);
+
+/**
+ * @brief Get the number of observation values per game
+ * @param env The games
+ * @return The number of floats written per game to the observation buffer
+ */
+PACMAN_ENV_API int pacman_env_observation_size(const pacman_env* env);
+
+/**
+ * @brief Set the observation written for each game
+ * @param env The games
+ * @param type PACMAN_ENV_OBS_FEATURES (default) or PACMAN_ENV_OBS_PLANES
+ * @return 0 on success, or -1 if @a type is invalid
+ *
+ * This changes pacman_env_observation_size, set the buffers afterwards
+ */
+PACMAN_ENV_API int pacman_env_set_observation_type(pacman_env* env, int type);
+
+/**
+ * @brief Get the shape of a plane observation
+ * @param env The games
+ * @param planes Receives the number of planes, may be NULL
+ * @param rows Receives the number of rows of a plane, may be NULL
+ * @param cols Receives the number of columns of a plane, may be NULL
+ */
+PACMAN_ENV_API void pacman_env_plane_shape(const pacman_env* env, int* planes, int* rows, int* cols);
+
+/**
+ * @brief Set the caller owned buffers the games write their results to
+ * @param env The games
+ * @param observations The observation buffer
+ * @param rewards The reward buffer, the points scored in the last step
+ * @param dones The done buffer, 1 for a game that ended in the last step
+ */
+PACMAN_ENV_API void pacman_env_set_buffers(pacman_env* env, float* observations, float* rewards, uint8_t* dones);
+
+/**
+ * @brief Set the number of steps after which a game is ended
+ * @param env The games
+ * @param max_ticks The maximum number of steps per game (default: one hour of game time)
+ */
+PACMAN_ENV_API void pacman_env_set_max_episode_ticks(pacman_env* env, uint64_t max_ticks);
+
+/**
+ * @brief Set the number of game steps each call to pacman_env_step makes
+ * @param env The games
+ * @param frame_skip The number of steps to hold each action for (default: 1)
+ * @return 0 on success, or -1 if @a frame_skip is less than 1
+ *
+ * The observations are only written after the last of the steps, and the
+ * rewards add up the points scored over all of them
+ */
+PACMAN_ENV_API int pacman_env_set_frame_skip(pacman_env* env, int frame_skip);
+
+/**
+ * @brief Start a new game in every environment
+ * @param env The games
+ * @return 0 on success, or -1 if the buffers are not set
+ */
+PACMAN_ENV_API int pacman_env_reset(pacman_env* env);
+
+/**
+ * @brief Advance every game by the frame skip number of steps
+ * @param env The games
+ * @param actions One PACMAN_ENV_ACTION_* value per game
+ * @return 0 on success, or -1 if the buffers are not set
+ *
+ * A game that ends is reset at once, the observation written for it is the
+ * first one of its next game
+ */
+PACMAN_ENV_API int pacman_env_step(pacman_env* env, const int32_t* actions);
+
+/**
+ * @brief Get the final score of the last game that ended in an environment
+ * @param env The games
+ * @param index The index of the environment
+ * @return The final score, or -1 if no game has ended in it yet or @a index is invalid
+ */
+PACMAN_ENV_API int pacman_env_episode_score(const pacman_env* env, int index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PACMAN_PACMANENV_H */
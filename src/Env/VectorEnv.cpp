@@ -0,0 +1,245 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "VectorEnv.h"
+#include "Common/Constants.h"
+#include <algorithm>
+#include <cassert>
+
+namespace pm {
+    ///////////////////////////////////////////////////////////////
+    VectorEnv::VectorEnv(const Maze& maze, const LevelRules& rules, std::size_t envCount, std::uint64_t seed, unsigned int threadCount) :
+        maze_{maze},
+        simulation_{maze, rules},
+        planeEncoder_{maze},
+        observationType_{ObservationType::Features},
+        states_(envCount),
+        nextSeeds_(envCount),
+        episodeScores_(envCount, -1),
+        maxEpisodeTicks_{static_cast<std::uint64_t>(60 * 60 / Simulation::TIMESTEP)},
+        frameSkip_{1},
+        observations_{nullptr},
+        rewards_{nullptr},
+        dones_{nullptr},
+        actions_{nullptr},
+        threadCount_{std::clamp(threadCount, 1u, static_cast<unsigned int>(std::max<std::size_t>(envCount, 1)))},
+        job_{Job::Reset},
+        jobId_{0},
+        pendingWorkers_{0},
+        isStopping_{false}
+    {
+        for (std::size_t i = 0; i < envCount; i++)
+            nextSeeds_[i] = seed + i;
+
+        for (unsigned int i = 1; i < threadCount_; i++)
+            workers_.emplace_back(&VectorEnv::runWorker, this, i);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void VectorEnv::setBuffers(float* observations, float* rewards, std::uint8_t* dones) {
+        observations_ = observations;
+        rewards_ = rewards;
+        dones_ = dones;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool VectorEnv::hasBuffers() const {
+        return observations_ && rewards_ && dones_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void VectorEnv::setObservationType(ObservationType type) {
+        observationType_ = type;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t VectorEnv::getObservationSize() const {
+        return observationType_ == ObservationType::Planes ? planeEncoder_.getObservationSize() : FEATURE_COUNT;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void VectorEnv::setMaxEpisodeTicks(std::uint64_t maxTicks) {
+        maxEpisodeTicks_ = maxTicks;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void VectorEnv::setFrameSkip(unsigned int frameSkip) {
+        assert(frameSkip > 0 && "The frame skip must be at least one step");
+        frameSkip_ = frameSkip;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void VectorEnv::reset() {
+        assert(hasBuffers() && "The buffers must be set before the environments are reset");
+        run(Job::Reset);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void VectorEnv::step(const std::int32_t* actions) {
+        assert(hasBuffers() && "The buffers must be set before the environments are stepped");
+        actions_ = actions;
+        run(Job::Step);
+        actions_ = nullptr;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t VectorEnv::getEnvCount() const {
+        return states_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int VectorEnv::getEpisodeScore(std::size_t index) const {
+        assert(index < episodeScores_.size() && "Environment index out of range");
+        return episodeScores_[index];
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void VectorEnv::run(Job job) {
+        if (workers_.empty()) {
+            runChunk(job, 0);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_ = job;
+            jobId_++;
+            pendingWorkers_ = static_cast<unsigned int>(workers_.size());
+        }
+
+        jobStarted_.notify_all();
+        runChunk(job, 0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        jobFinished_.wait(lock, [this] { return pendingWorkers_ == 0; });
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void VectorEnv::runChunk(Job job, unsigned int threadIndex) {
+        std::size_t begin = states_.size() * threadIndex / threadCount_;
+        std::size_t end = states_.size() * (threadIndex + 1) / threadCount_;
+
+        for (std::size_t i = begin; i < end; i++) {
+            GameState& state = states_[i];
+
+            if (job == Job::Step) {
+                std::int32_t action = actions_[i];
+                Dir input = action >= 1 && action <= 4 ? static_cast<Dir>(action - 1) : Dir::None;
+                int score = state.score;
+
+                // A game is not allowed to run past the step limit in the middle of an action
+                auto ticksLeft = maxEpisodeTicks_ > state.tick ? maxEpisodeTicks_ - state.tick : 1;
+                simulation_.advance(state, input, static_cast<unsigned int>(std::min<std::uint64_t>(frameSkip_, ticksLeft)));
+                rewards_[i] = static_cast<float>(state.score - score);
+                dones_[i] = state.phase == GamePhase::GameOver || state.tick >= maxEpisodeTicks_;
+
+                if (!dones_[i]) {
+                    writeObservation(i);
+                    continue;
+                }
+
+                episodeScores_[i] = state.score;
+            } else {
+                rewards_[i] = 0.0f;
+                dones_[i] = 0;
+            }
+
+            simulation_.reset(state, nextSeeds_[i]);
+            nextSeeds_[i] += states_.size();
+            writeObservation(i);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void VectorEnv::runWorker(unsigned int threadIndex) {
+        std::uint64_t lastJobId = 0;
+
+        while (true) {
+            Job job;
+
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                jobStarted_.wait(lock, [&] { return isStopping_ || jobId_ != lastJobId; });
+                if (isStopping_)
+                    return;
+
+                job = job_;
+                lastJobId = jobId_;
+            }
+
+            runChunk(job, threadIndex);
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--pendingWorkers_ == 0)
+                jobFinished_.notify_one();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void VectorEnv::writeObservation(std::size_t index) {
+        const GameState& state = states_[index];
+        float* out = observations_ + index * getObservationSize();
+
+        if (observationType_ == ObservationType::Planes) {
+            planeEncoder_.encode(state, out);
+            return;
+        }
+
+        auto rowScale = 1.0f / static_cast<float>(maze_.getRowCount() - 1);
+        auto colmScale = 1.0f / static_cast<float>(maze_.getColumnCount() - 1);
+
+        // Pacman: position and one hot direction
+        const MoverState& pacman = state.pacman.mover;
+        *out++ = static_cast<float>(pacman.tile.row) * rowScale;
+        *out++ = static_cast<float>(pacman.tile.colm) * colmScale;
+        for (int dir = 0; dir < 4; dir++)
+            *out++ = pacman.direction == static_cast<Dir>(dir) ? 1.0f : 0.0f;
+
+        // Ghosts: position and whether they can be eaten or are returning to the house
+        for (const GhostActor& ghost : state.ghosts) {
+            *out++ = static_cast<float>(ghost.mover.tile.row) * rowScale;
+            *out++ = static_cast<float>(ghost.mover.tile.colm) * colmScale;
+            *out++ = ghost.mode == GhostMode::Frightened ? 1.0f : 0.0f;
+            *out++ = ghost.mode == GhostMode::Eaten ? 1.0f : 0.0f;
+        }
+
+        *out++ = static_cast<float>(state.remainingPelletCount) / static_cast<float>(maze_.getPelletCount());
+        *out++ = static_cast<float>(state.pacman.lives) / static_cast<float>(Constants::PLAYER_LiVES);
+        *out = state.phase == GamePhase::Playing ? 1.0f : 0.0f;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    VectorEnv::~VectorEnv() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            isStopping_ = true;
+        }
+
+        jobStarted_.notify_all();
+
+        for (auto& worker : workers_)
+            worker.join();
+    }
+
+} // namespace pm
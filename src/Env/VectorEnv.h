@@ -0,0 +1,222 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_VECTORENV_H
+#define PACMAN_VECTORENV_H
+
+#include "Core/Simulation.h"
+#include "Core/PlaneEncoder.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace pm {
+    /**
+     * @brief Steps many independent games with a single call
+     *
+     * Each game is advanced by pm::Simulation, the same simulation that
+     * pm::GameplayScene presents, so an agent trains on exactly the game a
+     * player plays. The caller owns the observation, reward and done
+     * buffers, and every call writes the result of all games into them
+     * in place. A game that ends is reset straight away with a new
+     * seed, so the observation written for it is the first one of its next
+     * game. Environment n starts with seed (seed + n) and every reset adds
+     * the number of environments to its seed, so no two games share one
+     *
+     * The games can be split over worker threads that live as long as the
+     * environment, each thread owns a contiguous range of games
+     */
+    class VectorEnv {
+    public:
+        static constexpr std::size_t FEATURE_COUNT = 25; //!< The number of values in a feature observation
+
+        /**
+         * @brief The observation written for each game
+         */
+        enum class ObservationType {
+            Features, //!< Positions and flags of pacman and the ghosts, pellets left, lives and phase
+            Planes    //!< One plane per object the size of the maze, see pm::PlaneEncoder
+        };
+
+        /**
+         * @brief Constructor
+         * @param maze The maze the games are played in
+         * @param rules The speeds, durations and fruits of each level
+         * @param envCount The number of games to run
+         * @param seed The seed of the first game
+         * @param threadCount The number of threads that step the games, including the calling thread
+         *
+         * @warning The maze and the rules must outlive the environment
+         */
+        VectorEnv(const Maze& maze, const LevelRules& rules, std::size_t envCount, std::uint64_t seed, unsigned int threadCount);
+
+        /**
+         * @brief Set the buffers the results are written to
+         * @param observations Receives getObservationSize() values per game
+         * @param rewards Receives the points scored by each game in the last step
+         * @param dones Receives 1 for each game that ended in the last step, otherwise 0
+         *
+         * The buffers must stay valid as long as they are set
+         */
+        void setBuffers(float* observations, float* rewards, std::uint8_t* dones);
+
+        /**
+         * @brief Check if the result buffers are set
+         * @return True if the buffers are set, otherwise false
+         */
+        bool hasBuffers() const;
+
+        /**
+         * @brief Set the observation written for each game
+         * @param type The type of observation
+         *
+         * The observation buffer must be large enough for the new type.
+         * By default the features are written
+         */
+        void setObservationType(ObservationType type);
+
+        /**
+         * @brief Get the number of values in the observation of one game
+         * @return The number of values
+         */
+        std::size_t getObservationSize() const;
+
+        /**
+         * @brief Set the number of steps after which a game is ended
+         * @param maxTicks The maximum number of steps per game
+         *
+         * By default a game is ended after one hour of game time
+         */
+        void setMaxEpisodeTicks(std::uint64_t maxTicks);
+
+        /**
+         * @brief Set the number of game steps each call to step makes
+         * @param frameSkip The number of steps to hold each action for, at least 1
+         *
+         * The observation is only written after the last of the steps, and
+         * the reward is the number of points scored over all of them. By
+         * default every call makes a single step
+         */
+        void setFrameSkip(unsigned int frameSkip);
+
+        /**
+         * @brief Start a new game in every environment
+         *
+         * The buffers must be set. The rewards and dones are cleared
+         */
+        void reset();
+
+        /**
+         * @brief Advance every game by the frame skip number of steps
+         * @param actions The key pressed in each game, 0 for none or
+         *                1 + the pm::Dir to press
+         *
+         * The buffers must be set
+         */
+        void step(const std::int32_t* actions);
+
+        /**
+         * @brief Get the number of games
+         * @return The number of games
+         */
+        std::size_t getEnvCount() const;
+
+        /**
+         * @brief Get the final score of the last game that ended in an environment
+         * @param index The index of the environment
+         * @return The final score, or -1 if no game has ended in it yet
+         */
+        int getEpisodeScore(std::size_t index) const;
+
+        /**
+         * @brief Destructor
+         *
+         * Stops the worker threads
+         */
+        ~VectorEnv();
+
+    private:
+        /**
+         * @brief The work a call hands to the threads
+         */
+        enum class Job {
+            Reset,
+            Step
+        };
+
+        /**
+         * @brief Run a job on all games
+         * @param job The job to run
+         */
+        void run(Job job);
+
+        /**
+         * @brief Run a job on the games owned by a thread
+         * @param job The job to run
+         * @param threadIndex The index of the thread, 0 for the calling thread
+         */
+        void runChunk(Job job, unsigned int threadIndex);
+
+        /**
+         * @brief Wait for jobs and run them until the environment is destroyed
+         * @param threadIndex The index of the thread
+         */
+        void runWorker(unsigned int threadIndex);
+
+        /**
+         * @brief Write the observation of a game to the observation buffer
+         * @param index The index of the game
+         */
+        void writeObservation(std::size_t index);
+
+    private:
+        const Maze& maze_;                       //!< The maze the games are played in
+        Simulation simulation_;                  //!< Advances the games
+        PlaneEncoder planeEncoder_;              //!< Writes the plane observations
+        ObservationType observationType_;        //!< The observation written for each game
+        std::vector<GameState> states_;          //!< The state of each game
+        std::vector<std::uint64_t> nextSeeds_;   //!< The seed of the next game in each environment
+        std::vector<int> episodeScores_;         //!< The final score of the last game that ended in each environment
+        std::uint64_t maxEpisodeTicks_;          //!< The maximum number of steps per game
+        unsigned int frameSkip_;                 //!< The number of steps each action is held for
+        float* observations_;                    //!< Caller owned observation buffer
+        float* rewards_;                         //!< Caller owned reward buffer
+        std::uint8_t* dones_;                    //!< Caller owned done buffer
+        const std::int32_t* actions_;            //!< The actions of the running step job
+        unsigned int threadCount_;               //!< The number of threads that step the games
+        std::vector<std::thread> workers_;       //!< The threads besides the calling one
+        std::mutex mutex_;                       //!< Guards the job hand over
+        std::condition_variable jobStarted_;     //!< Wakes the workers when a job is posted
+        std::condition_variable jobFinished_;    //!< Wakes the caller when the workers are done
+        Job job_;                                //!< The posted job
+        std::uint64_t jobId_;                    //!< Incremented every time a job is posted
+        unsigned int pendingWorkers_;            //!< The number of workers still running the posted job
+        bool isStopping_;                        //!< A flag indicating whether the workers should exit
+    };
+}
+
+#endif //PACMAN_VECTORENV_H
@@ -26,6 +26,7 @@
 #include "Scoreboard/Scoreboard.h"
 #include "Scenes/StartUpScene.h"
 #include "Common/Constants.h"
+#include <random>
 
 namespace pm {
     ///////////////////////////////////////////////////////////////
@@ -75,6 +76,12 @@ namespace pm {
         engine_.getCache().addProperty(ime::Property{"PLAYER_LIVES", Constants::PLAYER_LiVES});
         engine_.getCache().addProperty(ime::Property{"LEVEL_RESTART_COUNT", Constants::MAX_NUM_LEVEL_RESTARTS});
 
+        // Every level seeds its random number generator from this value, a game
+        // played with the same seed and input therefore plays out the same way
+        std::random_device randomDevice;
+        auto seed = (static_cast<std::uint64_t>(randomDevice()) << 32u) | randomDevice();
+        engine_.getCache().addProperty(ime::Property{"GAME_SEED", seed});
+
         // Load disk configs
         engine_.getSavableCache().load(engine_.getCache().getValue<std::string>("SETTINGS_FILENAME"));
 
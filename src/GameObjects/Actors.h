@@ -34,6 +34,5 @@
 #include "PacMan.h"
 #include "Pellet.h"
 #include "Wall.h"
-#include "Sensor.h"
 
 #endif
@@ -27,7 +27,8 @@
 namespace pm {
     ///////////////////////////////////////////////////////////////
     Fruit::Fruit(ime::Scene& scene, Type type) :
-        ime::GridObject(scene)
+        ime::GridObject(scene),
+        type_{type}
     {
         setCollisionGroup("fruits");
 
@@ -82,4 +83,9 @@ namespace pm {
         return "Fruit";
     }
 
+    ///////////////////////////////////////////////////////////////
+    Fruit::Type Fruit::getType() const {
+        return type_;
+    }
+
 } // namespace pm
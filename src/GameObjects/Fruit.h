@@ -25,6 +25,7 @@
 #ifndef PACMAN_FRUIT_H
 #define PACMAN_FRUIT_H
 
+#include "Core/GameState.h"
 #include <IME/core/object/GridObject.h>
 #include <IME/graphics/SpriteSheet.h>
 
@@ -37,16 +38,7 @@ namespace pm {
         /**
          * @brief Fruit type
          */
-        enum class Type {
-            Cherry,      //!< Cherry
-            Strawberry,  //!< Strawberry
-            Peach,       //!< Peach
-            Apple,       //!< Apple
-            Melon,       //!< Melon
-            Galaxian,    //!< Galaxian
-            Bell,        //!< Bell
-            Key          //!< Key
-        };
+        using Type = FruitType;
 
         /**
          * @brief Constructor
@@ -60,6 +52,15 @@ namespace pm {
          * @return The name of the class
          */
         std::string getClassName() const override;
+
+        /**
+         * @brief Get the type of the fruit
+         * @return The type of the fruit
+         */
+        Type getType() const;
+
+    private:
+        Type type_; //!< The type of the fruit
     };
 }
 
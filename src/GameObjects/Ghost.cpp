@@ -24,41 +24,33 @@
 
 #include "Ghost.h"
 #include "Utils/Utils.h"
-#include "AI/ghost/GIdleState.h"
+#include "AI/ghost/GhostPersonality.h"
 #include "Animations/GhostAnimations.h"
-#include <memory>
-#include <cassert>
 
 namespace pm {
     ///////////////////////////////////////////////////////////////
     Ghost::Ghost(ime::Scene& scene, Colour colour) :
         ime::GridObject(scene),
-        isLockedInHouse_{false}
+        colour_{colour},
+        personality_{&GhostPersonality::get(colour)}
     {
         setCollisionGroup("ghosts");
+        setTag(personality_->tag);
 
-        if (colour == Colour::Red) {
+        if (colour == Colour::Red)
             setDirection(ime::Right);
-            setTag("blinky");
-        } else if (colour == Colour::Pink) {
+        else if (colour == Colour::Pink)
             setDirection(ime::Down);
-            setTag("pinky");
-        } else if (colour == Colour::Cyan) {
+        else
             setDirection(ime::Up);
-            setTag("inky");
-        } else if (colour == Colour::Orange) {
-            setDirection(ime::Up);
-            setTag("clyde");
-        }
 
+        ime::GridObject::setState(static_cast<int>(State::Idle));
         initAnimations();
     }
 
     ///////////////////////////////////////////////////////////////
-    void Ghost::initFSM() {
-        fsm_.clear();
-        fsm_.push(std::make_unique<GIdleState>(&fsm_, this));
-        fsm_.start();
+    Ghost::Colour Ghost::getColour() const {
+        return colour_;
     }
 
     ///////////////////////////////////////////////////////////////
@@ -66,6 +58,21 @@ namespace pm {
         return "Ghost";
     }
 
+    ///////////////////////////////////////////////////////////////
+    void Ghost::setState(State state) {
+        if (getState() == state)
+            return;
+
+        ime::GridObject::setState(static_cast<int>(state));
+
+        if (state == State::Frightened)
+            getSprite().getAnimator().startAnimation("frightened");
+        else if (state == State::Eaten)
+            getSprite().getAnimator().startAnimation("going" + utils::convertToString(getDirection()) + "Eaten");
+        else
+            getSprite().getAnimator().startAnimation("going" + utils::convertToString(getDirection()));
+    }
+
     ///////////////////////////////////////////////////////////////
     Ghost::State Ghost::getState() const {
         return static_cast<Ghost::State>(ime::GridObject::getState());
@@ -88,36 +95,11 @@ namespace pm {
         return getSprite().getAnimator().getActiveAnimation()->getName() == "flash";
     }
 
-    ///////////////////////////////////////////////////////////////
-    void Ghost::lockInGhostHouse(bool lock) {
-        isLockedInHouse_ = lock;
-    }
-
-    ///////////////////////////////////////////////////////////////
-    bool Ghost::isLockedInGhostHouse() const {
-        return isLockedInHouse_;
-    }
-
-    ///////////////////////////////////////////////////////////////
-    void Ghost::update(ime::Time deltaTime) {
-        assert(fsm_.top() && "A ghost FSM must have at least one state before an updated");
-        ime::GridObject::update(deltaTime);
-        fsm_.top()->update(deltaTime);
-    }
-
-    ///////////////////////////////////////////////////////////////
-    void Ghost::handleEvent(GameEvent event, const ime::PropertyContainer &args) {
-        assert(fsm_.top() && "A ghost FSM must have at least one state before handling an event");
-        fsm_.top()->handleEvent(event, args);
-    }
-
     ///////////////////////////////////////////////////////////////
     void Ghost::initAnimations() {
         GhostAnimations animations;
-        animations.createAnimations(getTag());
-
-        int spriteSheetRow = getTag() == "blinky" ? 0 : (getTag() == "pinky" ? 1 : (getTag() == "inky" ? 2 : 3));
-        getSprite() = animations.getAll().at(0)->getSpriteSheet().getSprite(ime::Index{spriteSheetRow, 0});
+        animations.createAnimations(personality_->spriteSheetRow);
+        getSprite() = animations.getAll().at(0)->getSpriteSheet().getSprite(ime::Index{personality_->spriteSheetRow, 0});
         for (const auto& animation : animations.getAll())
             getSprite().getAnimator().addAnimation(animation);
 
@@ -140,7 +122,4 @@ namespace pm {
         });
     }
 
-    ///////////////////////////////////////////////////////////////
-    Ghost::~Ghost() = default;
-
 } // namespace pm
@@ -25,14 +25,16 @@
 #ifndef PACMAN_GHOST_H
 #define PACMAN_GHOST_H
 
-#include "AI/ActorStateFSM.h"
 #include <IME/core/object/GridObject.h>
 
 namespace pm {
-    class GhostGridMover;
+    struct GhostPersonality;
 
     /**
      * @brief Ghost actor
+     *
+     * The ghost only presents a ghost of pm::GameState, what it does is
+     * decided by pm::Simulation
      */
     class Ghost : public ime::GridObject {
     public:
@@ -66,9 +68,10 @@ namespace pm {
         Ghost(ime::Scene& scene, Colour colour);
 
         /**
-         * @brief Initialize the ghosts Finite State Machine
+         * @brief Get the colour of the ghost
+         * @return The colour of the ghost
          */
-        void initFSM();
+        Colour getColour() const;
 
         /**
          * @brief Get the name of this class
@@ -76,14 +79,17 @@ namespace pm {
          */
         std::string getClassName() const override;
 
+        /**
+         * @brief Set the current state of the ghost
+         * @param state The new state of the ghost
+         *
+         * The ghost switches to the animation of the state
+         */
+        void setState(State state);
+
         /**
          * @brief Get the current state of the ghost
          * @return The current state of the ghost
-         *
-         * @warning Calling this function before the ghosts FSM is initialized
-         * is undefined behavior
-         *
-         * @see initFSM
          */
         State getState() const;
 
@@ -101,41 +107,6 @@ namespace pm {
          */
         bool isFlashAnimationPlaying() const;
 
-        /**
-         * @brief Lock or unlock the ghost from the ghost house
-         * @param lock True to lock the ghost or false to unlock the ghost
-         *
-         * By default, the ghost is not locked in the ghost house
-         *
-         * @warning The ghost must physically be in the ghost house before locking
-         * it inside, otherwise undefined behavior
-         */
-        void lockInGhostHouse(bool lock);
-
-        /**
-         * @brief Check if the ghost is locked in the ghost house or not
-         * @return True if locked in the ghost house, otherwise false
-         */
-        bool isLockedInGhostHouse() const;
-
-        /**
-         * @brief Update the ghost
-         * @param deltaTime Time passed since last update
-         */
-        void update(ime::Time deltaTime) override;
-
-        /**
-         * @brief Handle a game event
-         * @param event The event to be handled
-         * @param args Arguments associated with the event
-         */
-        virtual void handleEvent(GameEvent event, const ime::PropertyContainer& args);
-
-        /**
-         * @brief Destructor
-         */
-        ~Ghost() override;
-
     private:
         /**
          * @brief Initialize Animations
@@ -143,8 +114,8 @@ namespace pm {
         void initAnimations();
 
     private:
-        ActorStateFSM fsm_;          //!< Ghosts finite state machine
-        bool isLockedInHouse_;       //!< A flag indicating whether or not the ghost is locked in the ghost pen
+        Colour colour_;                       //!< The colour of the ghost
+        const GhostPersonality* personality_; //!< Defines how the ghost looks
     };
 }
 
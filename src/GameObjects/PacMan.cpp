@@ -25,13 +25,11 @@
 #include "PacMan.h"
 #include "Animations/PacManAnimations.h"
 #include "Utils/Utils.h"
-#include "Common/Constants.h"
 
 namespace pm {
     ///////////////////////////////////////////////////////////////
     PacMan::PacMan(ime::Scene& scene) :
         ime::GridObject(scene),
-        livesCount_{Constants::PLAYER_LiVES},
         state_{State::Unknown}
     {
         setTag("pacman");
@@ -43,27 +41,6 @@ namespace pm {
         setState(State::Idle);
     }
 
-    ///////////////////////////////////////////////////////////////
-    void PacMan::setLivesCount(int numOfLives) {
-        livesCount_ = numOfLives;
-    }
-
-    ///////////////////////////////////////////////////////////////
-    void PacMan::addLife() {
-        livesCount_++;
-    }
-
-    ///////////////////////////////////////////////////////////////
-    void PacMan::removeLife() {
-        if (livesCount_ > 0)
-            livesCount_--;
-    }
-
-    ///////////////////////////////////////////////////////////////
-    int PacMan::getLivesCount() const {
-        return livesCount_;
-    }
-
     ///////////////////////////////////////////////////////////////
     void PacMan::switchAnimation(ime::Direction dir) {
         if (state_ != State::Dying) {
@@ -30,6 +30,9 @@
 namespace pm {
     /**
      * @brief Player controlled actor
+     *
+     * Pacman only presents pacman of pm::GameState, how he moves is
+     * decided by pm::Simulation
      */
     class PacMan : public ime::GridObject {
     public:
@@ -49,30 +52,6 @@ namespace pm {
          */
         explicit PacMan(ime::Scene& scene);
 
-        /**
-         * @brief Set the number of lives
-         * @param numOfLives New number of lives
-         *
-         * By default, the player lives is pm::Constants::PLAYER_LiVES
-         */
-        void setLivesCount(int numOfLives);
-
-        /**
-         * @brief Add one life
-         */
-        void addLife();
-
-        /**
-         * @brief Remove one life
-         */
-        void removeLife();
-
-        /**
-         * @brief Get number of lives remaining
-         * @return The number of lives remaining
-         */
-        int getLivesCount() const;
-
         /**
          * @brief Get the name of this class
          * @return The name of this class
@@ -106,8 +85,7 @@ namespace pm {
         void initAnimations();
 
     private:
-        int livesCount_;             //!< The GameObjects current number of lives
-        State state_;                //!< Pacmans current state
+        State state_; //!< Pacmans current state
     };
 }
 
@@ -0,0 +1,152 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "DistanceTable.h"
+#include <fstream>
+
+namespace pm {
+    namespace {
+        constexpr std::uint32_t FILE_MAGIC = 0x54534450; // "PDST"
+        constexpr std::uint32_t FILE_VERSION = 1;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    DistanceTable::DistanceTable() :
+        rowCount_{0},
+        colmCount_{0},
+        tileCount_{0},
+        checksum_{0}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    void DistanceTable::create(const NavigationTable& navTable) {
+        rowCount_ = navTable.getRowCount();
+        colmCount_ = navTable.getColumnCount();
+        tileCount_ = static_cast<std::size_t>(rowCount_ * colmCount_);
+        checksum_ = computeChecksum(navTable);
+        distances_.assign(tileCount_ * tileCount_, UNREACHABLE);
+
+        static constexpr Dir directions[] = {Dir::Up, Dir::Left, Dir::Down, Dir::Right};
+        std::vector<int> queue(tileCount_);
+
+        for (int source = 0; source < static_cast<int>(tileCount_); source++) {
+            if (!navTable.isWalkable(source / colmCount_, source % colmCount_))
+                continue;
+
+            std::uint16_t* row = &distances_[static_cast<std::size_t>(source) * tileCount_];
+            row[source] = 0;
+
+            std::size_t head = 0, tail = 0;
+            queue[tail++] = source;
+
+            while (head < tail) {
+                int tile = queue[head++];
+                int tileRow = tile / colmCount_;
+                int tileColm = tile % colmCount_;
+                std::uint8_t exits = navTable.getExits(tileRow, tileColm);
+                auto nextDistance = static_cast<std::uint16_t>(row[tile] + 1);
+
+                auto visit = [&](int neighbour) {
+                    if (row[neighbour] == UNREACHABLE) {
+                        row[neighbour] = nextDistance;
+                        queue[tail++] = neighbour;
+                    }
+                };
+
+                for (Dir dir : directions) {
+                    if (exits & dirBit(dir))
+                        visit(toTileId(tileRow + rowOffset(dir), tileColm + colmOffset(dir)));
+                }
+
+                // Actors that reach one edge of the maze are teleported to the other edge
+                if (tileColm == 0 && navTable.isWalkable(tileRow, colmCount_ - 1))
+                    visit(toTileId(tileRow, colmCount_ - 1));
+                else if (tileColm == colmCount_ - 1 && navTable.isWalkable(tileRow, 0))
+                    visit(toTileId(tileRow, 0));
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool DistanceTable::saveToFile(const std::string& filename) const {
+        std::ofstream file(filename, std::ios::binary);
+        if (!file)
+            return false;
+
+        const std::uint32_t header[] = {FILE_MAGIC, FILE_VERSION, static_cast<std::uint32_t>(rowCount_),
+            static_cast<std::uint32_t>(colmCount_), checksum_};
+
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(distances_.data()), static_cast<std::streamsize>(distances_.size() * sizeof(std::uint16_t)));
+        return static_cast<bool>(file);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool DistanceTable::loadFromFile(const std::string& filename, const NavigationTable& navTable) {
+        std::ifstream file(filename, std::ios::binary);
+        if (!file)
+            return false;
+
+        std::uint32_t header[5] = {};
+        file.read(reinterpret_cast<char*>(header), sizeof(header));
+
+        if (!file || header[0] != FILE_MAGIC || header[1] != FILE_VERSION ||
+            static_cast<int>(header[2]) != navTable.getRowCount() ||
+            static_cast<int>(header[3]) != navTable.getColumnCount() ||
+            header[4] != computeChecksum(navTable))
+        {
+            return false;
+        }
+
+        auto tileCount = static_cast<std::size_t>(header[2] * header[3]);
+        std::vector<std::uint16_t> distances(tileCount * tileCount);
+        file.read(reinterpret_cast<char*>(distances.data()), static_cast<std::streamsize>(distances.size() * sizeof(std::uint16_t)));
+
+        if (!file)
+            return false;
+
+        rowCount_ = static_cast<int>(header[2]);
+        colmCount_ = static_cast<int>(header[3]);
+        tileCount_ = tileCount;
+        checksum_ = header[4];
+        distances_ = std::move(distances);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::uint32_t DistanceTable::computeChecksum(const NavigationTable& navTable) {
+        // FNV-1a over the exits of every tile
+        std::uint32_t hash = 2166136261u;
+
+        for (int row = 0; row < navTable.getRowCount(); row++) {
+            for (int colm = 0; colm < navTable.getColumnCount(); colm++) {
+                hash ^= navTable.getExits(row, colm) | (navTable.isWalkable(row, colm) ? 0x10u : 0u);
+                hash *= 16777619u;
+            }
+        }
+
+        return hash;
+    }
+
+} // namespace pm
@@ -0,0 +1,137 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_DISTANCETABLE_H
+#define PACMAN_DISTANCETABLE_H
+
+#include "Grid2D/NavigationTable.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace pm {
+    /**
+     * @brief Shortest path distances between every pair of tiles in the maze
+     *
+     * The distances are measured in tiles and are computed once per maze by
+     * running a breadth first search from every walkable tile. Unlike the
+     * straight-line distance, the path distance takes walls into account.
+     * Walkable tiles on the left and right edges of the same row are treated
+     * as adjacent, since actors are teleported between them
+     */
+    class DistanceTable {
+    public:
+        static constexpr std::uint16_t UNREACHABLE = 0xFFFF; //!< Distance between tiles that are not connected
+
+        /**
+         * @brief Default constructor
+         *
+         * The table is empty until pm::DistanceTable::create is called
+         */
+        DistanceTable();
+
+        /**
+         * @brief Compute the distances from a navigation table
+         * @param navTable The navigation table of the maze
+         */
+        void create(const NavigationTable& navTable);
+
+        /**
+         * @brief Get the path distance between two tiles
+         * @param fromRow The row of the start tile
+         * @param fromColm The column of the start tile
+         * @param toRow The row of the destination tile
+         * @param toColm The column of the destination tile
+         * @return The number of steps between the tiles or
+         *         pm::DistanceTable::UNREACHABLE if there is no path between
+         *         them or either tile is outside the maze
+         */
+        std::uint16_t getDistance(int fromRow, int fromColm, int toRow, int toColm) const {
+            if (!contains(fromRow, fromColm) || !contains(toRow, toColm))
+                return UNREACHABLE;
+
+            return distances_[static_cast<std::size_t>(toTileId(fromRow, fromColm)) * tileCount_ + toTileId(toRow, toColm)];
+        }
+
+        /**
+         * @brief Check if a tile is inside the maze
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return True if the tile is inside the maze, otherwise false
+         */
+        bool contains(int row, int colm) const {
+            return row >= 0 && row < rowCount_ && colm >= 0 && colm < colmCount_;
+        }
+
+        /**
+         * @brief Save the table to a file
+         * @param filename The name of the file to save the table to
+         * @return True if the table was saved, otherwise false
+         *
+         * The table is saved in binary form together with a checksum of
+         * the maze it was computed from
+         */
+        bool saveToFile(const std::string& filename) const;
+
+        /**
+         * @brief Load a table that was previously saved to a file
+         * @param filename The name of the file to load the table from
+         * @param navTable The navigation table of the maze the table belongs to
+         * @return True if the table was loaded, or false if the file could
+         *         not be read or was computed for a different maze
+         *
+         * If this function returns false, the table is left unchanged
+         *
+         * @see saveToFile
+         */
+        bool loadFromFile(const std::string& filename, const NavigationTable& navTable);
+
+    private:
+        /**
+         * @brief Convert a tile position to a tile id
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return The id of the tile
+         */
+        int toTileId(int row, int colm) const {
+            return row * colmCount_ + colm;
+        }
+
+        /**
+         * @brief Compute a checksum of a maze's navigation table
+         * @param navTable The navigation table to compute the checksum of
+         * @return The checksum of @a navTable
+         */
+        static std::uint32_t computeChecksum(const NavigationTable& navTable);
+
+    private:
+        int rowCount_;                         //!< The number of rows in the maze
+        int colmCount_;                        //!< The number of columns in the maze
+        std::size_t tileCount_;                //!< The number of tiles in the maze
+        std::uint32_t checksum_;               //!< Checksum of the maze the distances were computed for
+        std::vector<std::uint16_t> distances_; //!< Distances, indexed by [from tile id][to tile id]
+    };
+}
+
+#endif //PACMAN_DISTANCETABLE_H
@@ -0,0 +1,81 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "FlowField.h"
+
+namespace pm {
+    ///////////////////////////////////////////////////////////////
+    FlowField::FlowField() :
+        rowCount_{0},
+        colmCount_{0},
+        targetRow_{0},
+        targetColm_{0}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    void FlowField::create(const NavigationTable& navTable, const DistanceTable& distanceTable, int targetRow, int targetColm) {
+        rowCount_ = navTable.getRowCount();
+        colmCount_ = navTable.getColumnCount();
+        targetRow_ = targetRow;
+        targetColm_ = targetColm;
+        directions_.assign(static_cast<std::size_t>(rowCount_ * colmCount_), Dir::None);
+
+        static constexpr Dir directions[] = {Dir::Up, Dir::Left, Dir::Down, Dir::Right};
+
+        for (int row = 0; row < rowCount_; row++) {
+            for (int colm = 0; colm < colmCount_; colm++) {
+                if (row == targetRow && colm == targetColm)
+                    continue;
+
+                Dir bestDir = Dir::None;
+                std::uint16_t bestDistance = DistanceTable::UNREACHABLE;
+
+                for (Dir dir : directions) {
+                    if (!navTable.isOpen(row, colm, dir))
+                        continue;
+
+                    std::uint16_t distance = distanceTable.getDistance(row + rowOffset(dir), colm + colmOffset(dir), targetRow, targetColm);
+
+                    if (distance < bestDistance) {
+                        bestDistance = distance;
+                        bestDir = dir;
+                    }
+                }
+
+                directions_[static_cast<std::size_t>(row * colmCount_ + colm)] = bestDir;
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int FlowField::getTargetRow() const {
+        return targetRow_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int FlowField::getTargetColumn() const {
+        return targetColm_;
+    }
+
+} // namespace pm
@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_FLOWFIELD_H
+#define PACMAN_FLOWFIELD_H
+
+#include "Grid2D/NavigationTable.h"
+#include "Grid2D/DistanceTable.h"
+#include <vector>
+
+namespace pm {
+    /**
+     * @brief Precomputed direction towards a static target from every tile
+     *
+     * An actor that follows the field always takes a shortest path through
+     * the maze to the target, without measuring any distances along the way.
+     * This is useful for targets that never change, such as the tile eaten
+     * ghosts return to
+     */
+    class FlowField {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * The field is empty until pm::FlowField::create is called
+         */
+        FlowField();
+
+        /**
+         * @brief Build the field
+         * @param navTable The navigation table of the maze
+         * @param distanceTable The distance table of the maze
+         * @param targetRow The row of the target tile
+         * @param targetColm The column of the target tile
+         *
+         * The direction of a tile is the open exit whose adjacent tile is
+         * closest to the target by path distance. Equal distances are resolved
+         * in the arcade order: Up, Left, Down then Right
+         */
+        void create(const NavigationTable& navTable, const DistanceTable& distanceTable, int targetRow, int targetColm);
+
+        /**
+         * @brief Get the direction to take from a tile
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return The direction towards the target, or pm::Dir::None if the
+         *         tile is the target, a wall, outside the maze or cannot
+         *         reach the target
+         */
+        Dir getDirection(int row, int colm) const {
+            if (row < 0 || row >= rowCount_ || colm < 0 || colm >= colmCount_)
+                return Dir::None;
+
+            return directions_[static_cast<std::size_t>(row * colmCount_ + colm)];
+        }
+
+        /**
+         * @brief Get the row of the target tile
+         * @return The row of the target tile
+         */
+        int getTargetRow() const;
+
+        /**
+         * @brief Get the column of the target tile
+         * @return The column of the target tile
+         */
+        int getTargetColumn() const;
+
+    private:
+        int rowCount_;                //!< The number of rows in the maze
+        int colmCount_;               //!< The number of columns in the maze
+        int targetRow_;               //!< The row of the target tile
+        int targetColm_;              //!< The column of the target tile
+        std::vector<Dir> directions_; //!< Direction towards the target from each tile, stored row by row
+    };
+}
+
+#endif //PACMAN_FLOWFIELD_H
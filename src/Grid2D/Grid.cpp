@@ -39,7 +39,6 @@ namespace pm {
         renderLayers.removeByName("default"); // This layer is replaced by the background layer
         renderLayers.create("background");
         renderLayers.create("Walls");
-        renderLayers.create("Sensors");
         renderLayers.create("Fruits");
         renderLayers.create("Pellets");
         renderLayers.create("PacMans");
@@ -67,6 +66,11 @@ namespace pm {
         grid_.loadFromFile(filename);
     }
 
+    ///////////////////////////////////////////////////////////////
+    ime::Grid2D& Grid::getGrid2D() {
+        return grid_;
+    }
+
     ///////////////////////////////////////////////////////////////
     void Grid::setVisible(bool visible) {
         grid_.getRenderer().setVisible(visible);
@@ -102,6 +106,18 @@ namespace pm {
         grid_.removeChildWithId(id);
     }
 
+    ///////////////////////////////////////////////////////////////
+    void Grid::moveActor(ime::GridObject* actor, ime::Index index) {
+        grid_.removeChild(actor);
+        grid_.addChild(actor, index);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void Grid::setActorPosition(ime::GridObject* actor, ime::Index index, ime::Vector2f offset) {
+        ime::Vector2f centre = grid_.getTile(index).getWorldCentre();
+        actor->getTransform().setPosition(centre.x + offset.x, centre.y + offset.y);
+    }
+
     ///////////////////////////////////////////////////////////////
     void Grid::forEachCell(const ime::Callback<const ime::Tile&>& callback) {
         grid_.forEachTile([&callback](const ime::Tile& tile) {
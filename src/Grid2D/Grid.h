@@ -43,9 +43,18 @@ namespace pm {
         /**
          * @brief Create the grid
          * @param filename The name of the file that contains the grid data
+         *
+         * The grid only presents the maze, the gameplay rules read the
+         * same file through pm::Maze
          */
         void loadFromFile(const std::string& filename);
 
+        /**
+         * @brief Get the third party grid
+         * @return The third party grid
+         */
+        ime::Grid2D& getGrid2D();
+
         /**
          * @brief Show or hide the grid
          * @param visible True to show or false to hide
@@ -93,9 +102,32 @@ namespace pm {
         /**
          * @brief Remove an actor from the grid
          * @param id The id of the actor to be removed
+         *
+         * An actor must be removed from the grid before it is destroyed
          */
         void removeActor(int id);
 
+        /**
+         * @brief Move an actor to a tile
+         * @param actor The actor to be moved
+         * @param index The index of the tile to move the actor to
+         *
+         * The actor is placed on the centre of the tile
+         */
+        void moveActor(ime::GridObject* actor, ime::Index index);
+
+        /**
+         * @brief Place an actor between two tiles
+         * @param actor The actor to be placed
+         * @param index The index of the tile the actor occupies
+         * @param offset The offset (in pixels) of the actor from the
+         *               centre of the tile
+         *
+         * Only the drawn position of the actor changes, an actor that
+         * entered another tile must be moved to it with moveActor first
+         */
+        void setActorPosition(ime::GridObject* actor, ime::Index index, ime::Vector2f offset);
+
         /**
          * @brief Apply a callback to each cell of the grid
          * @param callback The function to be applied
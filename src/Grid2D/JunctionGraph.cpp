@@ -0,0 +1,136 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "JunctionGraph.h"
+#include <cassert>
+
+namespace pm {
+    namespace {
+        // Number of open directions in a mask of exits
+        int countExits(std::uint8_t exits) {
+            int count = 0;
+            for (; exits; exits &= static_cast<std::uint8_t>(exits - 1))
+                count++;
+
+            return count;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    JunctionGraph::JunctionGraph() :
+        rowCount_{0},
+        colmCount_{0}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    void JunctionGraph::create(const NavigationTable& navTable) {
+        rowCount_ = navTable.getRowCount();
+        colmCount_ = navTable.getColumnCount();
+        auto tileCount = static_cast<std::size_t>(rowCount_ * colmCount_);
+
+        nodes_.clear();
+        nodeIds_.assign(tileCount, -1);
+        corridorDirs_.assign(tileCount * 4, Dir::None);
+        runLengths_.assign(tileCount * 4, 0);
+
+        static constexpr Dir directions[] = {Dir::Up, Dir::Left, Dir::Down, Dir::Right};
+
+        // 1. Classify tiles and find the continuation direction of corridor tiles
+        for (int row = 0; row < rowCount_; row++) {
+            for (int colm = 0; colm < colmCount_; colm++) {
+                if (!navTable.isWalkable(row, colm))
+                    continue;
+
+                std::uint8_t exits = navTable.getExits(row, colm);
+                auto tile = static_cast<std::size_t>(row * colmCount_ + colm);
+
+                if (countExits(exits) != 2) {
+                    nodeIds_[tile] = static_cast<int>(nodes_.size());
+                    Node node;
+                    node.row = row;
+                    node.colm = colm;
+                    nodes_.push_back(node);
+                    continue;
+                }
+
+                for (Dir arrivalDir : directions) {
+                    std::uint8_t remaining = exits & static_cast<std::uint8_t>(~dirBit(reverseDir(arrivalDir)));
+
+                    // The index of the only remaining bit is the number of bits below it
+                    if (countExits(remaining) == 1)
+                        corridorDirs_[tile * 4 + static_cast<int>(arrivalDir)] = static_cast<Dir>(countExits(static_cast<std::uint8_t>(remaining - 1)));
+                }
+            }
+        }
+
+        // 2. Follow each exit of each walkable tile to the next junction
+        for (int row = 0; row < rowCount_; row++) {
+            for (int colm = 0; colm < colmCount_; colm++) {
+                if (!navTable.isWalkable(row, colm))
+                    continue;
+
+                for (Dir departureDir : directions) {
+                    if (!navTable.isOpen(row, colm, departureDir))
+                        continue;
+
+                    int curRow = row + rowOffset(departureDir);
+                    int curColm = colm + colmOffset(departureDir);
+                    Dir dir = departureDir;
+                    int length = 1;
+
+                    // A corridor loop without junctions cannot be longer than the maze
+                    while (!isJunction(curRow, curColm) && length <= static_cast<int>(tileCount)) {
+                        dir = getCorridorDirection(curRow, curColm, dir);
+                        assert(dir != Dir::None && "Corridor tiles must have exactly one way forward");
+                        curRow += rowOffset(dir);
+                        curColm += colmOffset(dir);
+                        length++;
+                    }
+
+                    auto tile = static_cast<std::size_t>(row * colmCount_ + colm);
+                    runLengths_[tile * 4 + static_cast<int>(departureDir)] = static_cast<std::uint16_t>(length);
+
+                    if (nodeIds_[tile] != -1) {
+                        Edge& edge = nodes_[static_cast<std::size_t>(nodeIds_[tile])].edges[static_cast<int>(departureDir)];
+                        edge.to = getNodeId(curRow, curColm);
+                        edge.length = length;
+                        edge.arrivalDir = dir;
+                    }
+                }
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    const JunctionGraph::Node& JunctionGraph::getNode(int id) const {
+        assert(id >= 0 && id < static_cast<int>(nodes_.size()) && "Invalid junction id");
+        return nodes_[static_cast<std::size_t>(id)];
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::size_t JunctionGraph::getNodeCount() const {
+        return nodes_.size();
+    }
+
+} // namespace pm
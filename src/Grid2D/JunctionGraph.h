@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_JUNCTIONGRAPH_H
+#define PACMAN_JUNCTIONGRAPH_H
+
+#include "Grid2D/NavigationTable.h"
+#include <cstdint>
+#include <vector>
+
+namespace pm {
+    /**
+     * @brief Compressed representation of the maze in which corridors are edges
+     *
+     * A junction is a walkable tile at which an actor that cannot reverse
+     * has to make a choice, that is a tile with three or more exits, or a
+     * dead end (a single exit). Every other walkable tile belongs to a corridor,
+     * which can only be traveled in one way without reversing. Actors can
+     * therefore traverse a whole corridor without making any decisions
+     */
+    class JunctionGraph {
+    public:
+        /**
+         * @brief A corridor that leaves a junction in a specific direction
+         */
+        struct Edge {
+            int to = -1;                //!< The id of the junction at the end of the corridor, or -1 if there is no corridor
+            int length = 0;             //!< The number of steps from the start junction to the end junction
+            Dir arrivalDir = Dir::None; //!< The direction of travel when the end junction is reached
+        };
+
+        /**
+         * @brief A junction in the maze
+         */
+        struct Node {
+            int row = 0;   //!< The row of the junction tile
+            int colm = 0;  //!< The column of the junction tile
+            Edge edges[4]; //!< Corridors leaving the junction, indexed by pm::Dir
+        };
+
+        /**
+         * @brief Default constructor
+         *
+         * The graph is empty until pm::JunctionGraph::create is called
+         */
+        JunctionGraph();
+
+        /**
+         * @brief Build the graph from a navigation table
+         * @param navTable The navigation table of the maze
+         */
+        void create(const NavigationTable& navTable);
+
+        /**
+         * @brief Check if a tile is a junction
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return True if the tile is a junction, otherwise false
+         */
+        bool isJunction(int row, int colm) const {
+            return getNodeId(row, colm) != -1;
+        }
+
+        /**
+         * @brief Get the id of the junction at a tile
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return The id of the junction or -1 if the tile is not a junction
+         */
+        int getNodeId(int row, int colm) const {
+            return contains(row, colm) ? nodeIds_[static_cast<std::size_t>(row * colmCount_ + colm)] : -1;
+        }
+
+        /**
+         * @brief Get a junction
+         * @param id The id of the junction
+         * @return The junction with the given id
+         */
+        const Node& getNode(int id) const;
+
+        /**
+         * @brief Get the number of junctions in the maze
+         * @return The number of junctions in the maze
+         */
+        std::size_t getNodeCount() const;
+
+        /**
+         * @brief Get the direction in which a corridor continues
+         * @param row The row of a corridor tile
+         * @param colm The column of a corridor tile
+         * @param dir The direction of travel when the tile was entered
+         * @return The only direction in which the tile can be left without
+         *         reversing, or pm::Dir::None if the tile is a junction, a
+         *         wall or @a dir is not a valid direction of travel on it
+         */
+        Dir getCorridorDirection(int row, int colm, Dir dir) const {
+            if (!contains(row, colm) || dir == Dir::None)
+                return Dir::None;
+
+            return corridorDirs_[static_cast<std::size_t>((row * colmCount_ + colm) * 4 + static_cast<int>(dir))];
+        }
+
+        /**
+         * @brief Get the number of steps to the next junction
+         * @param row The row of a walkable tile
+         * @param colm The column of a walkable tile
+         * @param dir The direction in which the tile is left
+         * @return The number of steps an actor has to take in order to reach
+         *         the next junction if it follows the corridor, or 0 if the
+         *         tile cannot be left in @a dir
+         */
+        int getRunLength(int row, int colm, Dir dir) const {
+            if (!contains(row, colm) || dir == Dir::None)
+                return 0;
+
+            return runLengths_[static_cast<std::size_t>((row * colmCount_ + colm) * 4 + static_cast<int>(dir))];
+        }
+
+    private:
+        /**
+         * @brief Check if a tile is inside the maze
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return True if the tile is inside the maze, otherwise false
+         */
+        bool contains(int row, int colm) const {
+            return row >= 0 && row < rowCount_ && colm >= 0 && colm < colmCount_;
+        }
+
+    private:
+        int rowCount_;                          //!< The number of rows in the maze
+        int colmCount_;                         //!< The number of columns in the maze
+        std::vector<int> nodeIds_;              //!< The junction id of each tile (-1 for non-junction tiles)
+        std::vector<Node> nodes_;               //!< The junctions of the maze
+        std::vector<Dir> corridorDirs_;         //!< Continuation direction, indexed by [tile][arrival direction]
+        std::vector<std::uint16_t> runLengths_; //!< Steps to the next junction, indexed by [tile][departure direction]
+    };
+}
+
+#endif //PACMAN_JUNCTIONGRAPH_H
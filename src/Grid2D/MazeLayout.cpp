@@ -22,19 +22,27 @@
 // SOFTWARE.
 ////////////////////////////////////////////////////////////////////////////////
 
-#include "Sensor.h"
+#include "MazeLayout.h"
+#include <fstream>
 
 namespace pm {
     ///////////////////////////////////////////////////////////////
-    Sensor::Sensor(ime::Scene &scene) :
-        ime::GridObject(scene)
-    {
-        setCollisionGroup("sensors");
-    }
+    MazeLayout loadMazeLayout(const std::string& filename) {
+        MazeLayout layout;
+        std::ifstream file(filename);
+        std::string line;
 
-    ///////////////////////////////////////////////////////////////
-    std::string Sensor::getClassName() const {
-        return "Sensor";
+        while (std::getline(file, line)) {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+
+            if (line.empty() || line.front() == '#')
+                continue;
+
+            layout.push_back(line);
+        }
+
+        return layout;
     }
 
 } // namespace pm
@@ -22,33 +22,28 @@
 // SOFTWARE.
 ////////////////////////////////////////////////////////////////////////////////
 
-#ifndef PACMAN_SENSOR_H
-#define PACMAN_SENSOR_H
+#ifndef PACMAN_MAZELAYOUT_H
+#define PACMAN_MAZELAYOUT_H
 
-#include <IME/core/object/GridObject.h>
+#include <string>
+#include <vector>
 
 namespace pm {
     /**
-     * @brief Sensor actor
-     *
-     * This class is used as a trigger for certain actions when an actor
-     * enters it. For example, it is used to detect when PacMan or a Ghost
-     * reaches the end of the tunnel
+     * @brief The tile ids of a maze, one string per row
      */
-    class Sensor : public ime::GridObject {
-    public:
-        /**
-         * @brief Constructor
-         * @param scene The scene the object belongs to
-         */
-        explicit Sensor(ime::Scene& scene);
+    using MazeLayout = std::vector<std::string>;
 
-        /**
-         * @brief Get the class type
-         * @return Name of the concrete class the pellet belongs to
-         */
-        std::string getClassName() const override;
-    };
+    /**
+     * @brief Read a maze layout from a file
+     * @param filename The name of the file that contains the maze
+     * @return The tile ids of the maze or an empty layout if the file
+     *         could not be read
+     *
+     * The file has the same format as the one accepted by ime::Grid2D:
+     * lines that start with '#' are comments and empty lines are ignored
+     */
+    MazeLayout loadMazeLayout(const std::string& filename);
 }
 
-#endif //PACMAN_SENSOR_H
+#endif //PACMAN_MAZELAYOUT_H
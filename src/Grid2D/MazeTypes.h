@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_MAZETYPES_H
+#define PACMAN_MAZETYPES_H
+
+#include <cstdint>
+
+namespace pm {
+    /**
+     * @brief A direction of travel in the maze
+     *
+     * The enumerators are declared in the order the arcade game breaks ties
+     * between equally good directions (Up > Left > Down > Right). Unlike
+     * ime::Direction, this type does not depend on the engine and can be
+     * stored in compact lookup tables
+     */
+    enum class Dir : std::uint8_t {
+        Up,    //!< Towards row 0
+        Left,  //!< Towards column 0
+        Down,  //!< Towards the last row
+        Right, //!< Towards the last column
+        None   //!< No direction
+    };
+
+    /**
+     * @brief Get the bit that represents a direction in an exits mask
+     * @param dir The direction to get the bit for
+     * @return The bit for @a dir or 0 if @a dir is pm::Dir::None
+     */
+    constexpr std::uint8_t dirBit(Dir dir) {
+        return dir == Dir::None ? 0 : static_cast<std::uint8_t>(1u << static_cast<unsigned>(dir));
+    }
+
+    /**
+     * @brief Get the opposite of a direction
+     * @param dir The direction to get the opposite of
+     * @return The opposite of @a dir
+     */
+    constexpr Dir reverseDir(Dir dir) {
+        return dir == Dir::None ? Dir::None : static_cast<Dir>((static_cast<unsigned>(dir) + 2u) % 4u);
+    }
+
+    /**
+     * @brief Get the row offset of a single step in a direction
+     * @param dir The direction of the step
+     * @return -1, 0 or 1
+     */
+    constexpr int rowOffset(Dir dir) {
+        return dir == Dir::Up ? -1 : (dir == Dir::Down ? 1 : 0);
+    }
+
+    /**
+     * @brief Get the column offset of a single step in a direction
+     * @param dir The direction of the step
+     * @return -1, 0 or 1
+     */
+    constexpr int colmOffset(Dir dir) {
+        return dir == Dir::Left ? -1 : (dir == Dir::Right ? 1 : 0);
+    }
+
+    /**
+     * @brief The position of a tile in the maze
+     *
+     * Unlike ime::Index, this type does not depend on the engine
+     */
+    struct TileIndex {
+        int row = 0;  //!< The row of the tile
+        int colm = 0; //!< The column of the tile
+    };
+
+    /**
+     * @brief Check if two tile positions are the same
+     * @param lhs The left operand
+     * @param rhs The right operand
+     * @return True if both positions refer to the same tile, otherwise false
+     */
+    constexpr bool operator==(const TileIndex& lhs, const TileIndex& rhs) {
+        return lhs.row == rhs.row && lhs.colm == rhs.colm;
+    }
+
+    /**
+     * @brief Check if two tile positions are different
+     * @param lhs The left operand
+     * @param rhs The right operand
+     * @return True if the positions refer to different tiles, otherwise false
+     */
+    constexpr bool operator!=(const TileIndex& lhs, const TileIndex& rhs) {
+        return !(lhs == rhs);
+    }
+}
+
+#endif //PACMAN_MAZETYPES_H
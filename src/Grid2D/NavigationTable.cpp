@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "NavigationTable.h"
+#include <cassert>
+
+namespace pm {
+    ///////////////////////////////////////////////////////////////
+    NavigationTable::NavigationTable() :
+        rowCount_{0},
+        colmCount_{0}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    void NavigationTable::create(const MazeLayout& layout) {
+        rowCount_ = static_cast<int>(layout.size());
+        colmCount_ = layout.empty() ? 0 : static_cast<int>(layout.front().size());
+        walkable_.assign(static_cast<std::size_t>(rowCount_ * colmCount_), false);
+        exits_.assign(static_cast<std::size_t>(rowCount_ * colmCount_), 0);
+
+        for (int row = 0; row < rowCount_; row++) {
+            assert(static_cast<int>(layout[row].size()) == colmCount_ && "All rows of a maze layout must have the same length");
+
+            for (int colm = 0; colm < colmCount_; colm++)
+                walkable_[static_cast<std::size_t>(row * colmCount_ + colm)] = !isWallId(layout[row][colm]);
+        }
+
+        static constexpr Dir directions[] = {Dir::Up, Dir::Left, Dir::Down, Dir::Right};
+
+        for (int row = 0; row < rowCount_; row++) {
+            for (int colm = 0; colm < colmCount_; colm++) {
+                std::uint8_t exits = 0;
+
+                for (Dir dir : directions) {
+                    if (isWalkable(row + rowOffset(dir), colm + colmOffset(dir)))
+                        exits |= dirBit(dir);
+                }
+
+                exits_[static_cast<std::size_t>(row * colmCount_ + colm)] = exits;
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int NavigationTable::getRowCount() const {
+        return rowCount_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    int NavigationTable::getColumnCount() const {
+        return colmCount_;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool NavigationTable::isWallId(char id) {
+        return id == '|' || id == '#';
+    }
+
+} // namespace pm
@@ -0,0 +1,131 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_NAVIGATIONTABLE_H
+#define PACMAN_NAVIGATIONTABLE_H
+
+#include "Grid2D/MazeTypes.h"
+#include "Grid2D/MazeLayout.h"
+#include <cstdint>
+#include <vector>
+
+namespace pm {
+    /**
+     * @brief Precomputed open exits of every tile in the maze
+     *
+     * The maze never changes during gameplay, therefore instead of asking the
+     * grid whether or not a tile in a given direction contains an obstacle
+     * each time an actor needs to make a decision, the answer is computed once
+     * when the maze is loaded and stored as a 4-bit mask per tile
+     */
+    class NavigationTable {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * The table is empty until pm::NavigationTable::create is called
+         */
+        NavigationTable();
+
+        /**
+         * @brief Build the table from a maze layout
+         * @param layout The tile ids of the maze
+         *
+         * Tiles with the id '|' or '#' are walls. A tile is open in a given
+         * direction if the adjacent tile in that direction exists and is not
+         * a wall. All rows must have the same length
+         */
+        void create(const MazeLayout& layout);
+
+        /**
+         * @brief Check if a tile can be left in a given direction
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @param dir The direction to check
+         * @return True if the adjacent tile in @a dir can be entered, otherwise false
+         *
+         * Tiles outside the maze are never open
+         */
+        bool isOpen(int row, int colm, Dir dir) const {
+            return (getExits(row, colm) & dirBit(dir)) != 0;
+        }
+
+        /**
+         * @brief Get the open exits of a tile
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return A mask of pm::dirBit values or 0 if the tile is outside the maze
+         */
+        std::uint8_t getExits(int row, int colm) const {
+            return contains(row, colm) ? exits_[static_cast<std::size_t>(row * colmCount_ + colm)] : 0;
+        }
+
+        /**
+         * @brief Check if a tile can be occupied by an actor
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return True if the tile exists and is not a wall, otherwise false
+         */
+        bool isWalkable(int row, int colm) const {
+            return contains(row, colm) && walkable_[static_cast<std::size_t>(row * colmCount_ + colm)];
+        }
+
+        /**
+         * @brief Check if a tile is inside the maze
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return True if the tile is inside the maze, otherwise false
+         */
+        bool contains(int row, int colm) const {
+            return row >= 0 && row < rowCount_ && colm >= 0 && colm < colmCount_;
+        }
+
+        /**
+         * @brief Get the number of rows in the maze
+         * @return The number of rows in the maze
+         */
+        int getRowCount() const;
+
+        /**
+         * @brief Get the number of columns in the maze
+         * @return The number of columns in the maze
+         */
+        int getColumnCount() const;
+
+        /**
+         * @brief Check if a tile id represents a wall
+         * @param id The id to be checked
+         * @return True if @a id is a wall id, otherwise false
+         */
+        static bool isWallId(char id);
+
+    private:
+        int rowCount_;                    //!< The number of rows in the maze
+        int colmCount_;                   //!< The number of columns in the maze
+        std::vector<std::uint8_t> exits_; //!< Open exits of each tile, stored row by row
+        std::vector<bool> walkable_;      //!< Flags whether or not each tile is a wall
+    };
+}
+
+#endif //PACMAN_NAVIGATIONTABLE_H
@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "TileAttributes.h"
+#include <cassert>
+
+namespace pm {
+    ///////////////////////////////////////////////////////////////
+    TileAttributes::TileAttributes() :
+        rowCount_{0},
+        colmCount_{0}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    void TileAttributes::create(const MazeLayout& layout) {
+        rowCount_ = static_cast<int>(layout.size());
+        colmCount_ = layout.empty() ? 0 : static_cast<int>(layout.front().size());
+        flags_.assign(static_cast<std::size_t>(rowCount_ * colmCount_), tileFlagBit(TileFlag::None));
+
+        for (int row = 0; row < rowCount_; row++) {
+            assert(static_cast<int>(layout[row].size()) == colmCount_ && "All rows of an attribute layout must have the same length");
+
+            for (int colm = 0; colm < colmCount_; colm++)
+                flags_[static_cast<std::size_t>(row * colmCount_ + colm)] = toFlags(layout[row][colm]);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool TileAttributes::findFirst(TileFlag flag, int& row, int& colm) const {
+        for (std::size_t i = 0; i < flags_.size(); i++) {
+            if (flags_[i] & tileFlagBit(flag)) {
+                row = static_cast<int>(i) / colmCount_;
+                colm = static_cast<int>(i) % colmCount_;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    std::uint8_t TileAttributes::toFlags(char id) {
+        switch (id) {
+            case 'N': return tileFlagBit(TileFlag::NoUpForGhosts);
+            case 'E': return tileFlagBit(TileFlag::GhostHouseEntrance);
+            case 'G': return tileFlagBit(TileFlag::GhostHouse);
+            case 'U': return tileFlagBit(TileFlag::Tunnel);
+            case 'T': return tileFlagBit(TileFlag::Teleport) | tileFlagBit(TileFlag::Tunnel);
+            case 'F': return tileFlagBit(TileFlag::FruitSpawn);
+            default:  return tileFlagBit(TileFlag::None);
+        }
+    }
+
+} // namespace pm
@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_TILEATTRIBUTES_H
+#define PACMAN_TILEATTRIBUTES_H
+
+#include "Grid2D/MazeLayout.h"
+#include <cstdint>
+#include <vector>
+
+namespace pm {
+    /**
+     * @brief Gameplay attributes of a tile
+     *
+     * A tile may have more than one attribute, the flags are combined
+     * into a bitmask (see tileFlagBit)
+     */
+    enum class TileFlag : std::uint8_t {
+        None               = 0,      //!< The tile has no special attributes
+        NoUpForGhosts      = 1 << 0, //!< Ghosts cannot move up from the tile, unless frightened
+        GhostHouse         = 1 << 1, //!< The tile is inside the ghost house
+        GhostHouseEntrance = 1 << 2, //!< Only eaten ghosts may move down from the tile into the ghost house
+        Tunnel             = 1 << 3, //!< Ghosts slow down on the tile
+        Teleport           = 1 << 4, //!< Actors are teleported to the other end of the row
+        FruitSpawn         = 1 << 5  //!< Fruits appear on the tile
+    };
+
+    /**
+     * @brief Get the bit that represents an attribute in a mask of attributes
+     * @param flag The attribute to get the bit for
+     * @return The bit for @a flag or 0 if @a flag is pm::TileFlag::None
+     */
+    constexpr std::uint8_t tileFlagBit(TileFlag flag) {
+        return static_cast<std::uint8_t>(flag);
+    }
+
+    /**
+     * @brief Precomputed gameplay attributes of every tile in the maze
+     *
+     * The attributes are read from a companion layer of the maze file which
+     * has the same dimensions as the maze. This allows new mazes to define
+     * their own special tiles without recompiling the game
+     */
+    class TileAttributes {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * The table is empty until pm::TileAttributes::create is called
+         */
+        TileAttributes();
+
+        /**
+         * @brief Build the table from an attribute layout
+         * @param layout The attribute ids of the maze tiles
+         *
+         * The attribute ids are as follows:
+         *  '.' = No attributes
+         *  'N' = pm::TileFlag::NoUpForGhosts
+         *  'E' = pm::TileFlag::GhostHouseEntrance
+         *  'G' = pm::TileFlag::GhostHouse
+         *  'U' = pm::TileFlag::Tunnel
+         *  'T' = pm::TileFlag::Teleport and pm::TileFlag::Tunnel
+         *  'F' = pm::TileFlag::FruitSpawn
+         *
+         * Unknown ids have no attributes. All rows must have the same length
+         */
+        void create(const MazeLayout& layout);
+
+        /**
+         * @brief Get the attributes of a tile
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return A mask of pm::TileFlag bits or 0 if the tile is outside the maze
+         */
+        std::uint8_t getFlags(int row, int colm) const {
+            return contains(row, colm) ? flags_[static_cast<std::size_t>(row * colmCount_ + colm)] : 0;
+        }
+
+        /**
+         * @brief Check if a tile has an attribute
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @param flag The attribute to check
+         * @return True if the tile has the attribute, otherwise false
+         */
+        bool has(int row, int colm, TileFlag flag) const {
+            return (getFlags(row, colm) & tileFlagBit(flag)) != 0;
+        }
+
+        /**
+         * @brief Find the first tile with a given attribute
+         * @param flag The attribute to search for
+         * @param row Set to the row of the tile if found
+         * @param colm Set to the column of the tile if found
+         * @return True if a tile with the attribute exists, otherwise false
+         *
+         * Tiles are searched row by row, from the top left tile
+         */
+        bool findFirst(TileFlag flag, int& row, int& colm) const;
+
+        /**
+         * @brief Check if a tile is inside the maze
+         * @param row The row of the tile
+         * @param colm The column of the tile
+         * @return True if the tile is inside the maze, otherwise false
+         */
+        bool contains(int row, int colm) const {
+            return row >= 0 && row < rowCount_ && colm >= 0 && colm < colmCount_;
+        }
+
+        /**
+         * @brief Convert an attribute id to its attributes
+         * @param id The id to be converted
+         * @return A mask of pm::TileFlag bits
+         */
+        static std::uint8_t toFlags(char id);
+
+    private:
+        int rowCount_;                    //!< The number of rows in the maze
+        int colmCount_;                   //!< The number of columns in the maze
+        std::vector<std::uint8_t> flags_; //!< Attributes of each tile, stored row by row
+    };
+}
+
+#endif //PACMAN_TILEATTRIBUTES_H
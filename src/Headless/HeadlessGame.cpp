@@ -0,0 +1,214 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "HeadlessGame.h"
+#include "Core/Simulation.h"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+namespace pm {
+    ///////////////////////////////////////////////////////////////
+    HeadlessGame::HeadlessGame() :
+        seed_{0},
+        maxTicks_{static_cast<std::uint64_t>(60 * 60 / Simulation::TIMESTEP)},
+        hashInterval_{Replay::DEFAULT_HASH_INTERVAL},
+        keyframeInterval_{Replay::DEFAULT_KEYFRAME_INTERVAL},
+        seekTick_{UINT64_MAX},
+        mazeDir_{"res/TextFiles/"}
+    {}
+
+    ///////////////////////////////////////////////////////////////
+    bool HeadlessGame::isRequested(int argc, char* argv[]) {
+        for (int i = 1; i < argc; i++) {
+            if (std::strcmp(argv[i], "--headless") == 0)
+                return true;
+        }
+
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool HeadlessGame::initialize(int argc, char* argv[]) {
+        for (int i = 1; i < argc; i++) {
+            std::string option = argv[i];
+
+            if (option == "--headless")
+                continue;
+            else if (i + 1 >= argc) {
+                std::cerr << "Missing value for option " << option << std::endl;
+                return false;
+            }
+
+            std::string value = argv[++i];
+
+            try {
+                if (option == "--seed")
+                    seed_ = std::stoull(value);
+                else if (option == "--ticks")
+                    maxTicks_ = std::stoull(value);
+                else if (option == "--input")
+                    inputFile_ = value;
+                else if (option == "--maze-dir")
+                    mazeDir_ = value + "/";
+                else if (option == "--record")
+                    recordFile_ = value;
+                else if (option == "--replay")
+                    replayFile_ = value;
+                else if (option == "--keyframe-interval")
+                    keyframeInterval_ = std::stoull(value);
+                else if (option == "--seek")
+                    seekTick_ = std::stoull(value);
+                else if (option == "--save-state")
+                    saveStateFile_ = value;
+                else if (option == "--load-state")
+                    loadStateFile_ = value;
+                else if (option == "--hash-interval") {
+                    hashInterval_ = static_cast<std::uint32_t>(std::stoul(value));
+                    if (hashInterval_ == 0)
+                        throw std::invalid_argument("hash interval");
+                }
+                else {
+                    std::cerr << "Unknown option " << option << std::endl;
+                    return false;
+                }
+            } catch (const std::exception&) {
+                std::cerr << "Invalid value for option " << option << ": " << value << std::endl;
+                return false;
+            }
+        }
+
+        if (!maze_.loadFromFile(mazeDir_ + "maze.txt", mazeDir_ + "maze_attributes.txt")) {
+            std::cerr << "Failed to load the maze from " << mazeDir_ << std::endl;
+            return false;
+        }
+
+        if (!levelRules_.loadFromFile(mazeDir_ + "level_profiles.txt")) {
+            std::cerr << "Failed to load the level profiles from " << mazeDir_ << std::endl;
+            return false;
+        }
+
+        if (!loadStateFile_.empty()) {
+            if (!replayFile_.empty() || !recordFile_.empty()) {
+                std::cerr << "A saved game cannot be resumed while recording or playing back a replay" << std::endl;
+                return false;
+            }
+
+            if (!snapshot_.loadFromFile(loadStateFile_)) {
+                std::cerr << "Failed to load the saved game " << loadStateFile_ << std::endl;
+                return false;
+            }
+
+            seed_ = snapshot_.getState().seed;
+        }
+
+        if (!replayFile_.empty()) {
+            if (!replay_.loadFromFile(replayFile_)) {
+                std::cerr << "Failed to load the replay " << replayFile_ << std::endl;
+                return false;
+            }
+
+            seed_ = replay_.getSeed();
+        } else if (inputFile_.empty())
+            input_.generate(seed_, maxTicks_);
+        else if (!input_.loadFromFile(inputFile_)) {
+            std::cerr << "Failed to load the input script " << inputFile_ << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    bool HeadlessGame::start() {
+        Simulation simulation{maze_, levelRules_};
+        ReplayCheck check;
+        auto startTime = std::chrono::steady_clock::now();
+
+        if (!replayFile_.empty() && seekTick_ != UINT64_MAX) {
+            if (!replay_.seek(simulation, state_, seekTick_)) {
+                std::cerr << "Cannot seek to tick " << seekTick_ << ", the replay ends at tick " << replay_.getTickCount() << std::endl;
+                return false;
+            }
+        } else if (!replayFile_.empty())
+            check = replay_.play(simulation, state_);
+        else if (!recordFile_.empty())
+            replay_.record(simulation, state_, seed_, input_, maxTicks_, hashInterval_, keyframeInterval_);
+        else {
+            if (snapshot_.isEmpty())
+                simulation.reset(state_, seed_);
+            else
+                snapshot_.restore(state_);
+
+            input_.play(simulation, state_, maxTicks_);
+        }
+
+        std::chrono::duration<double> wallTime = std::chrono::steady_clock::now() - startTime;
+        double ticksPerSecond = wallTime.count() > 0.0 ? static_cast<double>(state_.tick) / wallTime.count() : 0.0;
+
+        std::cout << "Headless game report\n"
+                  << "  seed:           " << seed_ << "\n"
+                  << "  result:         " << (state_.phase == GamePhase::GameOver ? "game over" : "step limit reached") << "\n"
+                  << "  score:          " << state_.score << "\n"
+                  << "  level:          " << state_.level << "\n"
+                  << "  deaths:         " << state_.deaths << "\n"
+                  << "  ticks:          " << state_.tick << "\n"
+                  << "  simulated time: " << static_cast<double>(state_.tick) * Simulation::TIMESTEP << " s\n"
+                  << "  wall time:      " << wallTime.count() << " s\n"
+                  << "  ticks/s:        " << static_cast<std::uint64_t>(ticksPerSecond) << "\n"
+                  << "  real time x:    " << static_cast<std::uint64_t>(ticksPerSecond * Simulation::TIMESTEP) << std::endl;
+
+        if (!replayFile_.empty() && seekTick_ != UINT64_MAX)
+            std::cout << "Seeked to tick " << seekTick_ << " of " << replay_.getTickCount() << " using " << replay_.getKeyframeCount() << " keyframes" << std::endl;
+        else if (!replayFile_.empty()) {
+            if (check.isDiverged) {
+                std::cout << "Replay diverged at tick " << check.divergedTick << " of " << replay_.getTickCount() << std::endl;
+                return false;
+            }
+
+            std::cout << "Replay verified, " << replay_.getEvents().size() << " key presses over " << check.tickCount << " ticks" << std::endl;
+        } else if (!recordFile_.empty()) {
+            if (!replay_.saveToFile(recordFile_)) {
+                std::cerr << "Failed to save the replay to " << recordFile_ << std::endl;
+                return false;
+            }
+
+            std::cout << "Recorded " << replay_.getEvents().size() << " key presses over " << state_.tick << " ticks to " << recordFile_ << std::endl;
+        }
+
+        if (!saveStateFile_.empty()) {
+            snapshot_.capture(state_);
+            if (!snapshot_.saveToFile(saveStateFile_)) {
+                std::cerr << "Failed to save the game to " << saveStateFile_ << std::endl;
+                return false;
+            }
+
+            std::cout << "Saved the game at tick " << state_.tick << " to " << saveStateFile_ << std::endl;
+        }
+
+        return true;
+    }
+
+} // namespace pm
@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_HEADLESSGAME_H
+#define PACMAN_HEADLESSGAME_H
+
+#include "Core/Maze.h"
+#include "Core/LevelRules.h"
+#include "Core/GameState.h"
+#include "Core/InputScript.h"
+#include "Core/Replay.h"
+#include "Core/Snapshot.h"
+#include <cstdint>
+#include <string>
+
+namespace pm {
+    /**
+     * @brief Plays a game without a window, rendering or audio
+     *
+     * The game is advanced with pm::Simulation at a fixed timestep as fast
+     * as the CPU allows, and the player's input comes from a pm::InputScript.
+     * Once the game is over (or the step limit is reached) a report with
+     * the outcome of the game and the number of steps simulated per second
+     * is printed to the standard output
+     *
+     * The game can also be recorded to a pm::Replay file, or a replay can
+     * be played back instead of the input script to check that it still
+     * produces the recorded game. A game can be saved when the simulation
+     * stops and resumed from that point in a later run
+     *
+     * Command line options:
+     *   --headless              Select the headless mode (see main.cpp)
+     *   --seed <number>         The seed of the game (default: 0)
+     *   --ticks <number>        The maximum number of steps to simulate (default: one hour of game time)
+     *   --input <filename>      The input script to play (default: random key presses generated from the seed)
+     *   --maze-dir <dir>        The directory that contains maze.txt, maze_attributes.txt and level_profiles.txt (default: res/TextFiles/)
+     *   --record <filename>     Record the game to a replay file
+     *   --hash-interval <n>     The number of steps between two state hashes in a recording, 1 to find the exact step a playback diverges in (default: 60)
+     *   --keyframe-interval <n> The number of steps between two keyframes in a recording, 0 for none (default: 7200)
+     *   --replay <filename>     Play back and verify a replay file, the seed and input options are ignored
+     *   --seek <tick>           Bring the replay to a step through its keyframes instead of verifying it
+     *   --save-state <file>     Save the state of the game to a snapshot file when the simulation stops
+     *   --load-state <file>     Resume the game saved in a snapshot file, the seed option is ignored
+     */
+    class HeadlessGame {
+    public:
+        /**
+         * @brief Constructor
+         */
+        HeadlessGame();
+
+        /**
+         * @brief Check if the command line selects the headless mode
+         * @param argc The number of command line arguments
+         * @param argv The command line arguments
+         * @return True if the headless mode is selected, otherwise false
+         */
+        static bool isRequested(int argc, char* argv[]);
+
+        /**
+         * @brief Initialize the game from the command line
+         * @param argc The number of command line arguments
+         * @param argv The command line arguments
+         * @return True if the game was initialized, or false if an option
+         *         is invalid or a file could not be loaded
+         */
+        bool initialize(int argc, char* argv[]);
+
+        /**
+         * @brief Play the game and print the report
+         * @return False if a replay diverged or a file could not be saved,
+         *         otherwise true
+         */
+        bool start();
+
+    private:
+        std::uint64_t seed_;             //!< The seed of the game
+        std::uint64_t maxTicks_;         //!< The maximum number of steps to simulate
+        std::uint32_t hashInterval_;     //!< The number of steps between two state hashes in a recording
+        std::uint64_t keyframeInterval_; //!< The number of steps between two keyframes in a recording
+        std::uint64_t seekTick_;         //!< The step to bring the replay to, or UINT64_MAX to verify it
+        std::string inputFile_;          //!< The input script to play, or an empty string for random key presses
+        std::string mazeDir_;            //!< The directory the maze and the level profiles are loaded from
+        std::string recordFile_;         //!< The file to record the game to, or an empty string to not record
+        std::string replayFile_;         //!< The replay to play back, or an empty string to play the input script
+        std::string saveStateFile_;      //!< The file to save the final state to, or an empty string to not save it
+        std::string loadStateFile_;      //!< The file to resume the game from, or an empty string to start a new game
+        Maze maze_;                      //!< The maze the game is played in
+        LevelRules levelRules_;          //!< The speeds, durations and fruits of each level
+        InputScript input_;              //!< Plays the part of the player
+        Replay replay_;                  //!< The recorded or played back game
+        Snapshot snapshot_;              //!< The saved or resumed game
+        GameState state_;                //!< The state of the game
+    };
+}
+
+#endif //PACMAN_HEADLESSGAME_H
@@ -0,0 +1,149 @@
+////////////////////////////////////////////////////////////////////////////////
+// Pac-Man clone
+//
+// Copyright (c) 2021 Kwena Mashamaite (kwena.mashamaite1@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PACMAN_GHOSTDECISIONKERNEL_H
+#define PACMAN_GHOSTDECISIONKERNEL_H
+
+#include "Grid2D/MazeTypes.h"
+#include "Grid2D/DistanceTable.h"
+#include <cstdint>
+
+namespace pm {
+    /**
+     * @brief The directions a ghost may choose from at a tile
+     *
+     * The directions are stored in a fixed size array in the arcade tie-break
+     * order (Up > Left > Down > Right), so building and scanning the candidates
+     * never allocates
+     */
+    struct DirectionCandidates {
+        Dir dirs[4] = {Dir::None, Dir::None, Dir::None, Dir::None}; //!< The candidate directions
+        int count = 0;                                              //!< The number of valid entries in dirs
+    };
+
+    /**
+     * @brief Allocation-free, integer-only ghost decision functions
+     *
+     * These functions make the same decisions as the original floating point
+     * implementation: squared distances preserve the ordering of distances
+     * and the first minimum wins, which is the arcade tie-break order
+     */
+    class GhostDecisionKernel {
+    public:
+        /**
+         * @brief Get the directions a ghost may take from a tile
+         * @param exits The open exits of the tile (see pm::NavigationTable::getExits)
+         * @param forbidden A mask of pm::dirBit values that must not be taken
+         * @return The directions in @a exits that are not in @a forbidden
+         *
+         * The reverse of the ghosts current direction is usually part
+         * of @a forbidden, since ghosts cannot turn around at will
+         */
+        static DirectionCandidates getCandidates(std::uint8_t exits, std::uint8_t forbidden) {
+            DirectionCandidates candidates;
+            std::uint8_t allowed = exits & static_cast<std::uint8_t>(~forbidden);
+
+            for (unsigned i = 0; i < 4; i++) {
+                if (allowed & (1u << i))
+                    candidates.dirs[candidates.count++] = static_cast<Dir>(i);
+            }
+
+            return candidates;
+        }
+
+        /**
+         * @brief Get the candidate with the smallest straight-line distance to a target
+         * @param candidates The directions to choose from
+         * @param row The row of the ghosts current tile
+         * @param colm The column of the ghosts current tile
+         * @param targetRow The row of the target tile
+         * @param targetColm The column of the target tile
+         * @return The chosen direction or pm::Dir::None if there are no candidates
+         */
+        static Dir getMinDistanceDirection(const DirectionCandidates& candidates, int row, int colm, int targetRow, int targetColm) {
+            Dir best = Dir::None;
+            int minDistance = 0;
+
+            for (int i = 0; i < candidates.count; i++) {
+                int dRow = targetRow - (row + rowOffset(candidates.dirs[i]));
+                int dColm = targetColm - (colm + colmOffset(candidates.dirs[i]));
+                int distance = dRow * dRow + dColm * dColm;
+
+                if (best == Dir::None || distance < minDistance) {
+                    minDistance = distance;
+                    best = candidates.dirs[i];
+                }
+            }
+
+            return best;
+        }
+
+        /**
+         * @brief Get the candidate with the smallest path distance to a target
+         * @param candidates The directions to choose from
+         * @param distances The distance table of the maze
+         * @param row The row of the ghosts current tile
+         * @param colm The column of the ghosts current tile
+         * @param targetRow The row of the target tile
+         * @param targetColm The column of the target tile
+         * @return The chosen direction or pm::Dir::None if there are no candidates
+         *
+         * If the target tile cannot be reached from the ghosts tile, the
+         * straight-line distance is used instead
+         */
+        static Dir getMinPathDistanceDirection(const DirectionCandidates& candidates, const DistanceTable& distances,
+            int row, int colm, int targetRow, int targetColm)
+        {
+            if (distances.getDistance(row, colm, targetRow, targetColm) == DistanceTable::UNREACHABLE)
+                return getMinDistanceDirection(candidates, row, colm, targetRow, targetColm);
+
+            Dir best = Dir::None;
+            unsigned minDistance = 0;
+
+            for (int i = 0; i < candidates.count; i++) {
+                unsigned distance = distances.getDistance(row + rowOffset(candidates.dirs[i]),
+                    colm + colmOffset(candidates.dirs[i]), targetRow, targetColm);
+
+                if (best == Dir::None || distance < minDistance) {
+                    minDistance = distance;
+                    best = candidates.dirs[i];
+                }
+            }
+
+            return best;
+        }
+
+        /**
+         * @brief Pick one of the candidates
+         * @param candidates The directions to choose from
+         * @param randomValue A uniformly distributed random number
+         * @return The chosen direction or pm::Dir::None if there are no candidates
+         */
+        static Dir getRandomDirection(const DirectionCandidates& candidates, std::uint32_t randomValue) {
+            return candidates.count == 0 ? Dir::None : candidates.dirs[randomValue % static_cast<std::uint32_t>(candidates.count)];
+        }
+    };
+}
+
+#endif //PACMAN_GHOSTDECISIONKERNEL_H
@@ -25,31 +25,56 @@
 #include "GameplayScene.h"
 #include "PauseMenuScene.h"
 #include "GameOverScene.h"
-#include "CollisionResponseRegisterer.h"
 #include "Utils/ObjectCreator.h"
+#include "Utils/Utils.h"
 #include "GameObjects/Actors.h"
 #include "Common/Constants.h"
-#include "PathFinders/PacManGridMover.h"
-#include "PathFinders/GhostGridMover.h"
-#include "Common/ObjectReferenceKeeper.h"
 #include <IME/core/engine/Engine.h>
+#include <IME/core/audio/SoundEffect.h>
 #include <IME/ui/widgets/Label.h>
-#include <IME/utility/Utils.h>
 #include <cassert>
+#include <cmath>
 
 namespace pm {
+    namespace {
+        constexpr float GRID_FLASH_DELAY = 0.5f;   //!< The time (in seconds) pacman remains frozen before the grid flashes
+        constexpr float GHOST_FLASH_CUTOFF = 2.0f; //!< The time (in seconds) left in frightened mode when the ghosts start flashing
+
+        // The views are looked up and updated by casting between these enumerations
+        static_assert(static_cast<int>(Ghost::Colour::Red) == Blinky && static_cast<int>(Ghost::Colour::Pink) == Pinky &&
+            static_cast<int>(Ghost::Colour::Cyan) == Inky && static_cast<int>(Ghost::Colour::Orange) == Clyde,
+            "Ghost::Colour must list the ghosts in the order of pm::GhostId");
+
+        static_assert(static_cast<int>(PacMan::State::Idle) == static_cast<int>(PacManMode::Idle) &&
+            static_cast<int>(PacMan::State::Moving) == static_cast<int>(PacManMode::Moving) &&
+            static_cast<int>(PacMan::State::Dying) == static_cast<int>(PacManMode::Dying),
+            "PacMan::State must list the states in the order of pm::PacManMode");
+
+        static_assert(static_cast<int>(Ghost::State::Idle) == static_cast<int>(GhostMode::Idle) &&
+            static_cast<int>(Ghost::State::Scatter) == static_cast<int>(GhostMode::Scatter) &&
+            static_cast<int>(Ghost::State::Chase) == static_cast<int>(GhostMode::Chase) &&
+            static_cast<int>(Ghost::State::Frightened) == static_cast<int>(GhostMode::Frightened) &&
+            static_cast<int>(Ghost::State::Eaten) == static_cast<int>(GhostMode::Eaten),
+            "Ghost::State must list the states in the order of pm::GhostMode");
+
+        ///////////////////////////////////////////////////////////////
+        std::uint64_t toTicks(float seconds) {
+            return static_cast<std::uint64_t>(std::lround(seconds / Simulation::TIMESTEP));
+        }
+    }
+
     ///////////////////////////////////////////////////////////////
     int GameplayScene::extraLivesGiven_{0};
 
     ///////////////////////////////////////////////////////////////
     GameplayScene::GameplayScene() :
         currentLevel_{-1},
-        pointsMultiplier_{1},
-        eatenPelletsCount_{0},
         view_{getGui()},
-        chaseModeWaveLevel_{0},
-        scatterModeWaveLevel_{0},
-        numGhostsInHouse_{0},
+        simulation_{maze_, levelRules_},
+        unsimulatedTime_{0.0f},
+        input_{Dir::None},
+        fruitScoreEndTick_{0},
+        levelCompleteTick_{0},
         onWindowCloseId_{-1}
     {}
 
@@ -58,24 +83,28 @@ namespace pm {
         currentLevel_ = getCache().getValue<int>("CURRENT_LEVEL");
         getAudio().setMasterVolume(getSCache().getPref("MASTER_VOLUME").getValue<float>());
 
-        ObjectReferenceKeeper::clear();
+        actors_.clear();
         createGrid();
+        initGameState();
         initGui();
         createActors();
-        createGridMovers();
-        initCollisionResponses();
         intiGameEvents();
         startCountDown();
+        updateActors();
     }
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::createGrid() {
         createGrid2D(Constants::GRID_TILE_SIZE, Constants::GRID_TILE_SIZE);
         grid_ = std::make_unique<Grid>(getGrid());
-        grid_->loadFromFile(getEngine().getConfigs().getPref("MAZE_DIR").getValue<std::string>() + "maze.txt");
+        const auto mazeDir = getEngine().getConfigs().getPref("MAZE_DIR").getValue<std::string>();
+        grid_->loadFromFile(mazeDir + "maze.txt");
         grid_->setPosition(ime::Vector2f{-34, 0});
         grid_->setBackgroundImagePosition(ime::Vector2f{246.0f, 298.0f});
 
+        [[maybe_unused]] bool isMazeLoaded = maze_.loadFromFile(mazeDir + "maze.txt", mazeDir + "maze_attributes.txt");
+        assert(isMazeLoaded && "Failed to load the maze");
+
 #ifndef NDEBUG
         grid_->setVisible(true);
 #else
@@ -83,65 +112,51 @@ namespace pm {
 #endif
     }
 
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::initGameState() {
+        const auto configsDir = getEngine().getConfigs().getPref("CONFIGS_DIR").getValue<std::string>();
+        [[maybe_unused]] bool isLoaded = levelRules_.loadFromFile(configsDir + "/level_profiles.txt");
+        assert(isLoaded && "Failed to load the level profiles");
+
+        state_ = GameState();
+        state_.seed = getCache().getValue<std::uint64_t>("GAME_SEED");
+        state_.isBoot = isBoot_;
+        state_.level = currentLevel_;
+        state_.score = getCache().getValue<int>("CURRENT_SCORE");
+        state_.extraLivesGiven = extraLivesGiven_;
+        state_.pacman.lives = getCache().getValue<int>("PLAYER_LIVES");
+        simulation_.startLevel(state_);
+    }
+
     ///////////////////////////////////////////////////////////////
     void GameplayScene::initGui() {
-        view_.init(getCache().getValue<int>("CURRENT_LEVEL"), getCache().getValue<int>("PLAYER_LIVES"));
+        view_.init(currentLevel_, state_.pacman.lives);
         view_.setHighScore(getCache().getValue<int>("HIGH_SCORE"));
-        view_.setScore(getCache().getValue<int>("CURRENT_SCORE"));
+        view_.setScore(state_.score);
     }
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::createActors() {
         ObjectCreator::createObjects(*grid_);
 
+        // The class names are only compared once, when the level is created
         grid_->forEachActor([this](ime::GridObject* actor) {
-            if (actor->getClassName() == "PacMan") {
-                ObjectReferenceKeeper::registerActor(actor);
-                static_cast<PacMan*>(actor)->setLivesCount(getCache().getValue<int>("PLAYER_LIVES"));
-            } else if (actor->getClassName() == "Ghost") {
-                ObjectReferenceKeeper::registerActor(actor);
-                actor->getUserData().addProperty({"is_in_tunnel", false});
-                actor->getCollisionExcludeList().add("tunnelExitSensor");
-                lockGhostInHouse(actor);
+            const std::string className = actor->getClassName();
+
+            if (className == "PacMan")
+                pacman_ = actors_.add(actor);
+            else if (className == "Ghost")
+                ghosts_[static_cast<GhostId>(static_cast<Ghost*>(actor)->getColour())] = actors_.add(actor);
+            else if (className == "Pellet") {
+                ime::Index index = grid_->getGrid2D().getTileOccupiedByChild(actor).getIndex();
+                pellets_.emplace_back(maze_.toTileId(index.row, index.colm), actors_.add(actor));
             }
         });
-    }
-
-    ///////////////////////////////////////////////////////////////
-    void GameplayScene::createGridMovers() {
-        // Pacman
-        auto* pacman = getGameObjects().findByTag<PacMan>("pacman");
-        auto pacmanGridMover = std::make_unique<PacManGridMover>(getGrid(), pacman );
-
-        pacmanGridMover->init(ime::TriggerKeys{
-            ime::Keyboard::stringToKey(getSCache().getPref("MOVE_LEFT_BUTTON").getValue<std::string>()),
-            ime::Keyboard::stringToKey(getSCache().getPref("MOVE_RIGHT_BUTTON").getValue<std::string>()),
-            ime::Keyboard::stringToKey(getSCache().getPref("MOVE_UP_BUTTON").getValue<std::string>()),
-            ime::Keyboard::stringToKey(getSCache().getPref("MOVE_DOWN_BUTTON").getValue<std::string>())
-        });
-
-        updatePacmanSpeed(pacman);
-
-        getGridMovers().addObject(std::move(pacmanGridMover));
-
-        // Ghosts
-        getGameObjects().forEachInGroup("Ghost", [this](ime::GameObject* ghostBase) {
-            auto* ghost = static_cast<Ghost*>(ghostBase);
-            auto ghostMover = std::make_unique<GhostGridMover>(getGrid(), ghost);
-            updateGhostSpeed(dynamic_cast<ime::GridObject*>(ghostBase));
-            ghost->initFSM();
-
-            int stateChangeId = ghost->onPropertyChange("state", [this, ghost](const ime::Property&) {
-                updateGhostSpeed(ghost);
-            });
 
-            ghostMover->onDestruction([gridMover = ghostMover.get(), stateChangeId] {
-                if (auto* pGhost = gridMover->getTarget())
-                    pGhost->removeEventListener("state", stateChangeId);
-            });
-
-            getGridMovers().addObject(std::move(ghostMover), "GhostMovers");
-        });
+        // The views start on the tiles the simulation placed the actors on
+        grid_->moveActor(actors_.get(pacman_), utils::convertToIndex(state_.pacman.mover.tile));
+        for (int i = 0; i < GhostCount; i++)
+            grid_->moveActor(actors_.get(ghosts_[i]), utils::convertToIndex(state_.ghosts[i].mover.tile));
     }
 
     ///////////////////////////////////////////////////////////////
@@ -155,51 +170,112 @@ namespace pm {
                 pauseGame();
         });
 
-        getEventEmitter().addOnceEventListener("levelComplete", ime::Callback<>([this] {
-            stopTimers();
-
-            if (getGameObjects().hasGroup("Fruit"))
-                getGameObjects().getGroup("Fruit").removeAll();
-
-            getGameObjects().getGroup("Ghost").removeAll();
-            getGridMovers().getGroup("GhostMovers").removeAll();
+        // The simulation reads the input once per step, the last key pressed wins
+        getInput().onKeyDown([this](ime::Keyboard::Key key) {
+            if (Dir dir = getInputDirection(key); dir != Dir::None)
+                input_ = dir;
+        });
+    }
 
-            // Momentarily freeze pacman before flashing the grid
-            getGameObjects().findByTag("pacman")->getSprite().getAnimator().setTimescale(0);
-            getGridMovers().findByTag("pacmanGridMover")->setMovementFreeze(true);
+    ///////////////////////////////////////////////////////////////
+    Dir GameplayScene::getInputDirection(ime::Keyboard::Key key) const {
+        auto isBoundTo = [this, key](const std::string& button) {
+            return key == ime::Keyboard::stringToKey(getSCache().getPref(button).getValue<std::string>());
+        };
 
-            getTimer().setTimeout(ime::milliseconds(500), [this] {
-                completeLevel();
-            });
-        }));
+        if (isBoundTo("MOVE_LEFT_BUTTON"))
+            return Dir::Left;
+        else if (isBoundTo("MOVE_RIGHT_BUTTON"))
+            return Dir::Right;
+        else if (isBoundTo("MOVE_UP_BUTTON"))
+            return Dir::Up;
+        else if (isBoundTo("MOVE_DOWN_BUTTON"))
+            return Dir::Down;
+        else
+            return Dir::None;
     }
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::onFrameEnd() {
-        getGameObjects().removeIf([](const ime::GameObject* actor) {
-            return !actor->isActive();
+        getGameObjects().removeIf([this](const ime::GameObject* actor) {
+            if (actor->isActive())
+                return false;
+
+            grid_->removeActor(actor->getObjectId());
+            return true;
         });
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::onUpdate(ime::Time deltaTime) {
+        view_.update(deltaTime);
+        grid_->update(deltaTime);
 
-        if (getGameObjects().getGroup("Pellet").getCount() == 0)
-            getEventEmitter().emit("levelComplete");
+        // The game advances in fixed steps whatever the frame rate, so it
+        // plays out exactly like a headless game with the same input. The
+        // scene stops stepping once the level it plays is over
+        unsimulatedTime_ += deltaTime.asSeconds();
+        while (unsimulatedTime_ >= Simulation::TIMESTEP && state_.level == currentLevel_ && state_.phase != GamePhase::GameOver) {
+            unsimulatedTime_ -= Simulation::TIMESTEP;
+
+            GameState prevState = state_;
+            simulation_.step(state_, input_);
+            input_ = Dir::None;
+            onStep(prevState);
+        }
+
+        updateActors();
+        flashGhosts();
     }
 
     ///////////////////////////////////////////////////////////////
-    void GameplayScene::initCollisionResponses() {
-        collisionResponseRegisterer_ = std::make_unique<CollisionResponseRegisterer>(*this);
+    void GameplayScene::onStep(const GameState& prevState) {
+        // The simulation starts the next level in the step the level complete phase ends
+        if (state_.level != currentLevel_) {
+            startNextLevel();
+            return;
+        }
 
-        /*-------------- Pacman collision handlers -----------------------*/
-        auto* pacman = getGameObjects().findByTag<PacMan>("pacman");
-        collisionResponseRegisterer_->registerCollisionWithPellets(pacman);
-        collisionResponseRegisterer_->registerCollisionWithFruit(pacman);
-        collisionResponseRegisterer_->registerCollisionWithGhost(pacman);
-        collisionResponseRegisterer_->registerCollisionWithTeleportationSensor(pacman);
+        updateActorTiles(prevState);
 
-        /*-------------- Ghosts collision handlers -----------------------*/
-        getGameObjects().forEachInGroup("Ghost", [this] (ime::GameObject* ghost) {
-            collisionResponseRegisterer_->registerCollisionWithTeleportationSensor(static_cast<ime::GridObject*>(ghost));
-            collisionResponseRegisterer_->registerCollisionWithSlowDownSensor(static_cast<ime::GridObject*>(ghost));
-        });
+        if (state_.remainingPelletCount != prevState.remainingPelletCount)
+            updatePellets();
+
+        updateFruit(prevState);
+        updateCaughtGhosts(prevState);
+
+        if (state_.score != prevState.score)
+            updateScore(prevState);
+
+        if (state_.pacman.lives != prevState.pacman.lives)
+            updateLives(prevState);
+
+        if (state_.phase != prevState.phase)
+            onPhaseChange();
+        else if (state_.phase == GamePhase::LevelComplete && state_.tick == levelCompleteTick_ + toTicks(GRID_FLASH_DELAY))
+            completeLevel();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::onPhaseChange() {
+        switch (state_.phase) {
+            case GamePhase::Countdown: // Pacman lost a life but has some left
+                resetActors();
+                startCountDown();
+                break;
+            case GamePhase::Playing:
+                endCountDown();
+                break;
+            case GamePhase::PacManDying:
+                onPacManDeath();
+                break;
+            case GamePhase::LevelComplete:
+                freezeLevel();
+                break;
+            case GamePhase::GameOver:
+                endGameplay();
+                break;
+        }
     }
 
     ///////////////////////////////////////////////////////////////
@@ -212,31 +288,26 @@ namespace pm {
 
         getInput().setAllInputEnable(false);
 
-        getTimer().setTimeout(ime::seconds(isBoot_ ? 2.15 * Constants::LEVEL_START_DELAY : Constants::LEVEL_START_DELAY), [this] {
-            getGameObjects().forEach([] (ime::GameObject* actor) {
-                actor->getSprite().getAnimator().setTimescale(1.0f);
-            });
-
-            getGui().getWidget("lblReady")->setVisible(false);
-            auto* pacman = getGameObjects().findByTag<PacMan>("pacman");
-            pacman->getSprite().getAnimator().setTimescale(1.0f);
-            pacman->setState(PacMan::State::Moving);
-
-            auto* soundEffect = getAudio().play(ime::audio::Type::Sfx, "wieu_wieu_slow.ogg");
-            soundEffect->setLoop(true);
-
-            startGhostHouseTimer();
-            startGhostScatterMode();
-            getInput().setAllInputEnable(true);
-            emit(GameEvent::LevelStarted);
-        });
-
         if (isBoot_) {
             isBoot_ = false;
             getAudio().play(ime::audio::Type::Sfx, "ready.wav");
         }
     }
 
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::endCountDown() {
+        getGameObjects().forEach([] (ime::GameObject* actor) {
+            actor->getSprite().getAnimator().setTimescale(1.0f);
+        });
+
+        getGui().getWidget("lblReady")->setVisible(false);
+
+        auto* soundEffect = getAudio().play(ime::audio::Type::Sfx, "wieu_wieu_slow.ogg");
+        soundEffect->setLoop(true);
+
+        getInput().setAllInputEnable(true);
+    }
+
     ///////////////////////////////////////////////////////////////
     void GameplayScene::pauseGame() {
         setOnPauseAction(ime::Scene::OnPauseAction::Show);
@@ -245,456 +316,329 @@ namespace pm {
     }
 
     ///////////////////////////////////////////////////////////////
-    void GameplayScene::completeLevel() {
-        getAudio().stopAll();
-        getGameObjects().removeByTag("pacman");
-        getCache().setValue("CURRENT_LEVEL", currentLevel_ + 1);
-        ime::Time gridAnimDuration = grid_->playFlashAnimation();
+    void GameplayScene::freezeLevel() {
+        levelCompleteTick_ = state_.tick;
+        removeFruit();
+
+        for (ActorHandle& ghost : ghosts_)
+            actors_.remove(ghost);
 
-        // Starts a new level shortly after the grid stops flashing
-        getTimer().setTimeout(gridAnimDuration + ime::seconds(1), [this] {
-            getEngine().popScene();
-            getEngine().pushScene(std::make_unique<GameplayScene>());
+        getGameObjects().forEachInGroup("Ghost", [this](ime::GameObject* ghost) {
+            grid_->removeActor(ghost->getObjectId());
         });
+
+        getGameObjects().getGroup("Ghost").removeAll();
+
+        // Momentarily freeze pacman before flashing the grid
+        getGameObjects().findByTag("pacman")->getSprite().getAnimator().setTimescale(0);
     }
 
     ///////////////////////////////////////////////////////////////
-    void GameplayScene::resetLevel() {
-        resetActors();
-        startCountDown();
+    void GameplayScene::completeLevel() {
+        getAudio().stopAll();
+        removePacMan();
+        grid_->playFlashAnimation();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::startNextLevel() {
+        getCache().setValue("CURRENT_LEVEL", state_.level);
+        getEngine().popScene();
+        getEngine().pushScene(std::make_unique<GameplayScene>());
     }
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::resetActors() {
-        getGridMovers().removeAll();
-
-        // Pacman
-        auto* pacman = getGameObjects().findByTag<PacMan>("pacman");
-        getGrid().removeChild(pacman);
-        getGrid().addChild(pacman, Constants::PACMAN_SPAWN_TILE);
-        static_cast<PacMan*>(pacman)->setState(PacMan::State::Idle);
-        static_cast<PacMan*>(pacman)->setDirection(ime::Left);
-
-        // Ghosts
-        numGhostsInHouse_ = 0;
-        getGameObjects().forEachInGroup("Ghost", [this](ime::GameObject* ghostBase) {
-            auto* ghost = dynamic_cast<Ghost*>(ghostBase);
+        getGameObjects().forEachInGroup("Ghost", [](ime::GameObject* ghost) {
             ghost->getSprite().setVisible(true);
-            ghost->getUserData().setValue("is_in_tunnel", false);
-
-            // Reset ghost positions in the grid
-            getGrid().removeChild(ghost);
-            if (ghost->getTag() == "blinky") {
-                getGrid().addChild(ghost, Constants::BLINKY_SPAWN_TILE);
-                static_cast<Ghost*>(ghost)->setDirection(ime::Left);
-            } else if (ghost->getTag() == "pinky") {
-                getGrid().addChild(ghost, Constants::PINKY_SPAWN_TILE);
-                static_cast<Ghost *>(ghost)->setDirection(ime::Down);
-            } else if (ghost->getTag() == "inky") {
-                getGrid().addChild(ghost, Constants::INKY_SPAWN_TILE);
-                static_cast<Ghost*>(ghost)->setDirection(ime::Up);
-            } else {
-                getGrid().addChild(ghost, Constants::CLYDE_SPAWN_TILE);
-                static_cast<Ghost*>(ghost)->setDirection(ime::Up);
-            }
-
-            lockGhostInHouse(ghost);
         });
-
-        createGridMovers();
     }
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::endGameplay() {
-        getGameObjects().removeByTag("pacman");
+        removePacMan();
         setOnPauseAction(ime::Scene::OnPauseAction::Show | ime::Scene::OnPauseAction::UpdateTime);
         getEngine().pushScene(std::make_unique<GameOverScene>());
     }
 
     ///////////////////////////////////////////////////////////////
-    void GameplayScene::onPrePacmanDeathAnim() {
-        getAudio().stopAll();
-        stopTimers();
-
-        chaseModeTimer_.stop();
-        frightenedModeTimer_.stop();
-        scatterModeTimer_.stop();
-        uneatenFruitTimer_.stop();
-        ghostHouseTimer_.stop();
+    void GameplayScene::removePacMan() {
+        ime::GameObject* pacman = getGameObjects().findByTag("pacman");
+        grid_->removeActor(pacman->getObjectId());
+        actors_.remove(pacman_);
+        getGameObjects().removeByTag("pacman");
+    }
 
-        auto pacman = getGameObjects().findByTag<PacMan>("pacman");
-        pacman->removeLife();
-        view_.removeLife();
-        getCache().setValue("PLAYER_LIVES", pacman->getLivesCount());
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::onPacManDeath() {
+        getAudio().stopAll();
+        removeFruit();
 
-        // Destroy fruit if it was spawned
-        getGameObjects().forEachInGroup("Fruit", [](ime::GameObject* fruit) {
-            fruit->setActive(false);
+        getGameObjects().forEachInGroup("Ghost", [](ime::GameObject* ghost) {
+            ghost->getSprite().setVisible(false);
         });
 
-        getGridMovers().forEach([](ime::GridMover* gridMover) {
-            gridMover->setMovementFreeze(true);
-        });
+        getAudio().play(ime::audio::Type::Sfx, "pacmanDying.wav");
     }
 
     ///////////////////////////////////////////////////////////////
-    void GameplayScene::onPostPacmanDeathAnim() {
-        if (getGameObjects().findByTag<PacMan>("pacman")->getLivesCount() <= 0)
-            endGameplay();
-        else
-            resetLevel();
-    }
+    void GameplayScene::updatePellets() {
+        for (auto iter = pellets_.begin(); iter != pellets_.end();) {
+            if (state_.hasPellet(iter->first)) {
+                ++iter;
+                continue;
+            }
 
-    ///////////////////////////////////////////////////////////////
-    void GameplayScene::onPause() {
-        getWindow().suspendedEventListener(onWindowCloseId_, true);
-        getAudio().pauseAll();
-    }
+            auto* pellet = actors_.get<Pellet>(iter->second);
+            if (pellet->getPelletType() == Pellet::Type::Energizer)
+                getAudio().play(ime::audio::Type::Sfx, "powerPelletEaten.wav");
+            else {
+                static auto wakkawakkaSfx = ime::audio::SoundEffect();
+                wakkawakkaSfx.setVolume(getAudio().getMasterVolume());
 
-    ///////////////////////////////////////////////////////////////
-    void GameplayScene::onResume() {
-        setOnPauseAction(ime::Scene::OnPauseAction::Default);
-        getWindow().suspendedEventListener(onWindowCloseId_, false);
-        getAudio().setMasterVolume(getSCache().getPref("MASTER_VOLUME").getValue<float>());
-        getAudio().playAll();
+                if (wakkawakkaSfx.getSource().empty())
+                    wakkawakkaSfx.setSource("WakkaWakka.ogg");
+
+                if (wakkawakkaSfx.getStatus() != ime::audio::Status::Playing)
+                    wakkawakkaSfx.play();
+            }
+
+            pellet->setActive(false);
+            actors_.remove(iter->second);
+            iter = pellets_.erase(iter);
+        }
     }
 
     ///////////////////////////////////////////////////////////////
-    void GameplayScene::onUpdate(ime::Time deltaTime) {
-        view_.update(deltaTime);
-        grid_->update(deltaTime);
-        ghostHouseTimer_.update(deltaTime);
-        chaseModeTimer_.update(deltaTime);
-        scatterModeTimer_.update(deltaTime);
-        frightenedModeTimer_.update(deltaTime);
-        uneatenFruitTimer_.update(deltaTime);
-        flashGhosts();
+    void GameplayScene::updateFruit(const GameState& prevState) {
+        if (!prevState.fruit.isActive && state_.fruit.isActive)
+            spawnFruit();
+        else if (prevState.fruit.isActive && !state_.fruit.isActive) {
+            // The fruit also disappears when it is left uneaten for too long
+            // or when pacman dies, pacman only eats it on its spawn tile
+            if (state_.phase == GamePhase::Playing && state_.pacman.mover.tile == maze_.getFruitSpawnTile()) {
+                replaceFruitWithScore();
+                getAudio().play(ime::audio::Type::Sfx, "fruitEaten.wav");
+            } else
+                removeFruit();
+        } else if (fruitScoreEndTick_ != 0 && state_.tick >= fruitScoreEndTick_)
+            removeFruit();
     }
 
     ///////////////////////////////////////////////////////////////
-    void GameplayScene::updateScore(int points) {
-        auto newScore = getCache().getValue<int>("CURRENT_SCORE") + points;
-        getCache().setValue("CURRENT_SCORE", newScore);
-        view_.setScore(newScore);
+    void GameplayScene::updateCaughtGhosts(const GameState& prevState) {
+        bool wasAnyGhostCaught = false, isAnyGhostCaught = false;
 
-        if (newScore > getCache().getValue<int>("HIGH_SCORE")) {
-            getCache().setValue("HIGH_SCORE", newScore);
-            view_.setHighScore(newScore);
-        }
+        for (int i = 0; i < GhostCount; i++) {
+            auto id = static_cast<GhostId>(i);
+            bool wasCaught = prevState.timers.isRunning(EatenDelayTimer + id);
+            wasAnyGhostCaught |= wasCaught;
+            isAnyGhostCaught |= isGhostCaught(id);
 
-        if (newScore >= Constants::FIRST_EXTRA_LIFE_MIN_SCORE && extraLivesGiven_ == 0 ||
-            newScore >= Constants::SECOND_EXTRA_LIFE_MIN_SCORE && extraLivesGiven_ == 1)
-        {
-            extraLivesGiven_++;
-            auto* pacman = getGameObjects().findByTag<PacMan>("pacman");
-            pacman->addLife();
-            getCache().setValue("PLAYER_LIVES", pacman->getLivesCount());
-            view_.addLife();
+            auto* ghost = actors_.get<Ghost>(ghosts_[id]);
+            if (!ghost || wasCaught == isGhostCaught(id))
+                continue;
 
-            getAudio().play(ime::audio::Type::Sfx, "extraLife.wav");
+            if (isGhostCaught(id)) {
+                replaceGhostWithScore(ghost, prevState.pointsMultiplier);
+                getAudio().play(ime::audio::Type::Sfx, "ghostEaten.wav");
+            } else // The ghost is eaten, its state animation replaces the score texture
+                ghost->getSprite().getAnimator().setTimescale(1.0f);
         }
-    }
 
-    ///////////////////////////////////////////////////////////////
-    void GameplayScene::emit(GameEvent event) {
-        ime::PropertyContainer args;
-        switch (event) {
-            case GameEvent::LevelStarted:
-                args.addProperty({"level", currentLevel_});
-                break;
-            default:
-                break;
+        // Pacman is hidden while the points of a caught ghost are shown
+        if (auto* pacman = actors_.get(pacman_); pacman && wasAnyGhostCaught != isAnyGhostCaught) {
+            pacman->getSprite().getAnimator().setTimescale(isAnyGhostCaught ? 0.0f : 1.0f);
+            pacman->getSprite().setVisible(!isAnyGhostCaught);
         }
-
-        getGameObjects().forEachInGroup("Ghost", [event, &args](ime::GameObject* ghost) {
-            static_cast<Ghost*>(ghost)->handleEvent(event, args);
-        });
     }
 
     ///////////////////////////////////////////////////////////////
-    void GameplayScene::updatePacmanSpeed(ime::GridObject* pacman) const {
-        assert(pacman->getGridMover() && "Cannot update pacman's speed without a grid mover");
+    void GameplayScene::updateScore(const GameState& prevState) {
+        getCache().setValue("CURRENT_SCORE", state_.score);
+        view_.setScore(state_.score);
 
-        float speed;
-        if (currentLevel_ == 1)
-            speed = 0.80f * Constants::PACMAN_SPEED;
-        else if (currentLevel_ >= 2 && currentLevel_ <= 4)
-            speed = 0.90f * Constants::PACMAN_SPEED;
-        else if (currentLevel_ >= 5 && currentLevel_ <= 20)
-            speed = Constants::PACMAN_SPEED;
-        else
-            speed = 0.90f * Constants::PACMAN_SPEED;
-
-        pacman->getGridMover()->setSpeed(ime::Vector2f{speed, speed});
-    }
-
-    ///////////////////////////////////////////////////////////////
-    void GameplayScene::updateGhostSpeed(ime::GridObject* ghost) const {
-        assert(ghost->getGridMover() && "Cannot update ghost's speed without a grid mover");
-
-        float speed = 0.0f;
-        auto* g = static_cast<Ghost*>(ghost);
-
-        if (g->getState() == Ghost::State::Eaten)
-            speed = 2.0f * Constants::PACMAN_SPEED;
-        else if (currentLevel_ == 1) {
-            if (g->getState() == Ghost::State::Frightened)
-                speed = 0.50f * Constants::PACMAN_SPEED;
-            else if (g->getUserData().getValue<bool>("is_in_tunnel"))
-                speed = 0.40 * Constants::PACMAN_SPEED;
-            else
-                speed = 0.75 * Constants::PACMAN_SPEED;
-        } else if (currentLevel_ >= 2 && currentLevel_ <= 4) {
-            if (g->getState() == Ghost::State::Frightened)
-                speed = 0.55f * Constants::PACMAN_SPEED;
-            else if (ghost->getUserData().getValue<bool>("is_in_tunnel"))
-                speed = 0.45f * Constants::PACMAN_SPEED;
-            else
-                speed = 0.85f * Constants::PACMAN_SPEED;
-        } else {
-            if (g->getState() == Ghost::State::Frightened) // Stops triggering from level 19 onwards
-                speed = 0.60f * Constants::PACMAN_SPEED;
-            else if (g->getUserData().getValue<bool>("is_in_tunnel"))
-                speed = 0.50f * Constants::PACMAN_SPEED;
-            else
-                speed = 0.95f * Constants::PACMAN_SPEED;
+        if (state_.score > getCache().getValue<int>("HIGH_SCORE")) {
+            getCache().setValue("HIGH_SCORE", state_.score);
+            view_.setHighScore(state_.score);
         }
 
-        ghost->getGridMover()->setSpeed(ime::Vector2f{speed, speed});
+        if (state_.extraLivesGiven != prevState.extraLivesGiven) {
+            extraLivesGiven_ = state_.extraLivesGiven;
+            getAudio().play(ime::audio::Type::Sfx, "extraLife.wav");
+        }
     }
 
     ///////////////////////////////////////////////////////////////
-    void GameplayScene::setMovementFreeze(bool freeze) {
-        getGridMovers().findByTag("pacmanGridMover")->setMovementFreeze(freeze);
+    void GameplayScene::updateLives(const GameState& prevState) {
+        getCache().setValue("PLAYER_LIVES", state_.pacman.lives);
 
-        getGridMovers().forEachInGroup("GhostMovers", [freeze](ime::GridMover* gridMover) {
-            Ghost::State state = static_cast<Ghost*>(gridMover->getTarget())->getState();
-            if ((state == Ghost::State::Eaten && freeze) ||
-                (!freeze && !gridMover->isMovementFrozen()))
-            {
-                return;
-            }
+        for (int lives = prevState.pacman.lives; lives < state_.pacman.lives; lives++)
+            view_.addLife();
 
-            gridMover->setMovementFreeze(freeze);
-        });
+        for (int lives = prevState.pacman.lives; lives > state_.pacman.lives; lives--)
+            view_.removeLife();
     }
 
     ///////////////////////////////////////////////////////////////
-    void GameplayScene::startGhostFrightenedMode() {
-        ime::Time duration;
-        if (currentLevel_ > Constants::GHOST_VULNERABILITY_LEVEL_CUTOFF)
-            duration = ime::seconds(0);
-        else if (currentLevel_ == 9 || currentLevel_ == 12 || currentLevel_ == 13 ||
-            currentLevel_ == 15 || currentLevel_ == 16 || currentLevel_ == 18)
-        {
-            duration = ime::seconds(1);
+    void GameplayScene::updateActors() {
+        if (auto* pacman = actors_.get<PacMan>(pacman_)) {
+            updateActorPosition(pacman, state_.pacman.mover);
+            pacman->setState(static_cast<PacMan::State>(state_.pacman.mode));
         }
-        else if (currentLevel_ == 5 || currentLevel_ == 7 || currentLevel_ == 8 ||
-            currentLevel_ == 11 || currentLevel_ == 12)
-        {
-            duration = ime::seconds(2);
-        }
-        else if (currentLevel_ == 4 || currentLevel_ == 14)
-            duration = ime::seconds(3);
-        else if (currentLevel_ == 3)
-            duration = ime::seconds(4);
-        else if (currentLevel_ == 6 || currentLevel_ == 10 || currentLevel_ == 2)
-            duration = ime::seconds(5);
-        else if (currentLevel_ == 1)
-            duration = ime::seconds(6);
-
-        if (frightenedModeTimer_.isRunning())
-            frightenedModeTimer_.setInterval(frightenedModeTimer_.getRemainingDuration() + duration);
-        else {
-            if (scatterModeTimer_.isRunning())
-                scatterModeTimer_.pause();
-            else if (chaseModeTimer_.isRunning())
-                chaseModeTimer_.pause();
-            else {
-                assert(false && "Ghost entered frightened mode from an invalid state: valid states are scatter and chase");
-            }
 
-            frightenedModeTimer_.setInterval(duration);
-            frightenedModeTimer_.onTimeout([this] {
-                pointsMultiplier_ = 1;
-                emit(GameEvent::FrightenedModeEnd);
-
-                // A paused timer implies that the ghost was in the state
-                // controlled by the timer before being frightened
-                if (scatterModeTimer_.isPaused())
-                    startGhostScatterMode();
-                else if (chaseModeTimer_.isPaused())
-                    startGhostChaseMode();
-                else {
-                    if (ime::utility::generateRandomNum(1, 100) >= 50)
-                        startGhostChaseMode();
-                    else
-                        startGhostScatterMode();
-                }
-            });
-
-            frightenedModeTimer_.start();
-            emit(GameEvent::FrightenedModeBegin);
+        for (int i = 0; i < GhostCount; i++) {
+            auto id = static_cast<GhostId>(i);
+            if (auto* ghost = actors_.get<Ghost>(ghosts_[id])) {
+                updateActorPosition(ghost, state_.ghosts[id].mover);
+
+                // A caught ghost keeps showing its points until it is eaten
+                if (!isGhostCaught(id))
+                    ghost->setState(static_cast<Ghost::State>(state_.ghosts[id].mode));
+            }
         }
     }
 
     ///////////////////////////////////////////////////////////////
-    void GameplayScene::startGhostScatterMode() {
-        if (scatterModeTimer_.isPaused()) {
-            scatterModeTimer_.start();
-            return;
-        }
+    void GameplayScene::updateActorTiles(const GameState& prevState) {
+        auto* pacman = actors_.get(pacman_);
+        if (pacman && state_.pacman.mover.tile != prevState.pacman.mover.tile)
+            grid_->moveActor(pacman, utils::convertToIndex(state_.pacman.mover.tile));
 
-        scatterModeWaveLevel_ += 1;
-        ime::Time duration;
-
-        if (scatterModeWaveLevel_ <= 2) {
-            if (currentLevel_ < 5)
-                duration = ime::seconds(7.0f);
-            else
-                duration = ime::seconds(5.0f);
-        } else if (scatterModeWaveLevel_ == 3)
-            duration = ime::seconds(5);
-        else {
-            if (currentLevel_ == 1)
-                duration = ime::seconds(5.0f);
-            else
-                duration = ime::seconds(1.0f / getEngine().getWindow().getFrameRateLimit()); // one frame
+        for (int i = 0; i < GhostCount; i++) {
+            auto* ghost = actors_.get(ghosts_[i]);
+            if (ghost && state_.ghosts[i].mover.tile != prevState.ghosts[i].mover.tile)
+                grid_->moveActor(ghost, utils::convertToIndex(state_.ghosts[i].mover.tile));
         }
+    }
 
-        // Transition to chase mode when timer expires
-        scatterModeTimer_.onTimeout([this] {
-            emit(GameEvent::ScatterModeEnd);
-            startGhostChaseMode();
-        });
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::updateActorPosition(ime::GridObject* actor, const MoverState& mover) {
+        ime::Direction moveDir = utils::convertToDirection(mover.moveDir);
+        ime::Vector2f offset{static_cast<float>(moveDir.x) * mover.distance, static_cast<float>(moveDir.y) * mover.distance};
+        grid_->setActorPosition(actor, utils::convertToIndex(mover.tile), offset);
 
-        scatterModeTimer_.setInterval(duration);
-        scatterModeTimer_.start();
-        emit(GameEvent::ScatterModeBegin);
+        // The direction is set before the state, so that a state change
+        // starts the animation of the new direction
+        ime::Direction direction = utils::convertToDirection(mover.direction);
+        if (mover.direction != Dir::None && actor->getDirection() != direction)
+            actor->setDirection(direction);
     }
 
     ///////////////////////////////////////////////////////////////
-    void GameplayScene::lockGhostInHouse(ime::GridObject* ghost) {
-        if ((ghost->getTag() == "pinky" && currentLevel_ == 1) ||
-            (ghost->getTag() == "inky" && currentLevel_ <= 2) ||
-            (ghost->getTag() == "clyde" && currentLevel_ <= 3))
-        {
-            static_cast<Ghost*>(ghost)->lockInGhostHouse(true);
-            numGhostsInHouse_ += 1;
-        }
+    bool GameplayScene::isGhostCaught(GhostId id) const {
+        return state_.timers.isRunning(EatenDelayTimer + id);
     }
 
     ///////////////////////////////////////////////////////////////
-    void GameplayScene::startGhostChaseMode() {
-        if (chaseModeTimer_.isPaused()) {
-            chaseModeTimer_.start();
-            return;
-        }
+    void GameplayScene::spawnFruit() {
+        removeFruit(); // The points of the previous fruit may still be shown
 
-        chaseModeWaveLevel_ += 1;
-        ime::Time duration;
-
-        // 1st and 2nd wave always lasts 20 seconds on all levels
-        if (chaseModeWaveLevel_ <= 2)
-            duration = ime::seconds(20.0f);
-        else if (chaseModeWaveLevel_ == 3) {
-            if (currentLevel_ == 1)
-                duration = ime::seconds(20.0f);
-            else if (currentLevel_ > 1 && currentLevel_ < 5)
-                duration = ime::seconds(1033);
-            else
-                duration = ime::seconds(1037);
-        }
+        auto fruit = std::make_unique<Fruit>(*this, state_.fruit.type);
+        fruit_ = actors_.add(fruit.get());
+        grid_->addActor(std::move(fruit), utils::convertToIndex(maze_.getFruitSpawnTile()));
+    }
 
-        // After the third chase wave, the ghosts remain in chase mode indefinitely.
-        // Even though the timer is not needed in the fourth chase wave, we keep
-        // it running so that a ghost can know in which state it should be in after
-        // frightened state expires
-        if (chaseModeWaveLevel_ == 4) {
-            chaseModeTimer_.setInterval(ime::hours(24)); // Any duration that is long enough not to timeout
-            chaseModeTimer_.onTimeout([] {});
-        } else {
-            chaseModeTimer_.setInterval(duration);
-
-            chaseModeTimer_.onTimeout([this] {
-                emit(GameEvent::ChaseModeEnd);
-                startGhostScatterMode();
-            });
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::removeFruit() {
+        if (auto* fruit = actors_.get(fruit_)) {
+            fruit->setActive(false);
+            actors_.remove(fruit_);
         }
 
-        chaseModeTimer_.start();
-
-        emit(GameEvent::ChaseModeBegin);
+        fruitScoreEndTick_ = 0;
     }
 
     ///////////////////////////////////////////////////////////////
-    void GameplayScene::startGhostHouseTimer() {
-        if (numGhostsInHouse_ == 0)
-            return;
+    void GameplayScene::replaceFruitWithScore() {
+        auto* fruit = actors_.get<Fruit>(fruit_);
+        assert(fruit && "Cannot replace a fruit that is not in the grid");
 
-        auto freeGhost = [this] {
-            if (numGhostsInHouse_ == 3) { // Release pinky
-                static_cast<Ghost*>(getGameObjects().getGroup("Ghost").findByTag("pinky"))->lockInGhostHouse(false);
-                ghostHouseTimer_.setInterval(ime::seconds(Constants::INKY_HOUSE_ARREST_DURATION));
-            } else if (numGhostsInHouse_ == 2) { // Release inky
-                static_cast<Ghost*>(getGameObjects().getGroup("Ghost").findByTag("inky"))->lockInGhostHouse(false);
-                ghostHouseTimer_.setInterval(ime::seconds(Constants::CLYDE_HOUSE_ARREST_DURATION));
-            } else // Release clyde
-                static_cast<Ghost*>(getGameObjects().getGroup("Ghost").findByTag("clyde"))->lockInGhostHouse(false);
-
-            numGhostsInHouse_ -= 1;
-        };
+        fruit->getSprite().setTexture("spritesheet.png");
 
-        ghostHouseTimer_.setInterval(ime::seconds(Constants::PINKY_HOUSE_ARREST_DURATION)); // Pinky is freed first
-        ghostHouseTimer_.onTimeout(freeGhost);
-        ghostHouseTimer_.setRepeatCount(2);
-        ghostHouseTimer_.start();
+        switch (fruit->getType()) {
+            case Fruit::Type::Cherry:
+                fruit->getSprite().setTextureRect(ime::UIntRect{1, 116, 16, 16});   // 100
+                break;
+            case Fruit::Type::Strawberry:
+                fruit->getSprite().setTextureRect(ime::UIntRect{18, 116, 16, 16});  // 300
+                break;
+            case Fruit::Type::Peach:
+                fruit->getSprite().setTextureRect(ime::UIntRect{35, 116, 16, 16});  // 500
+                break;
+            case Fruit::Type::Apple:
+                fruit->getSprite().setTextureRect(ime::UIntRect{52, 116, 16, 16});  // 700
+                break;
+            case Fruit::Type::Melon:
+                fruit->getSprite().setTextureRect(ime::UIntRect{69, 116, 16, 16});  // 1000
+                break;
+            case Fruit::Type::Galaxian:
+                fruit->getSprite().setTextureRect(ime::UIntRect{86, 116, 16, 16});  // 2000
+                break;
+            case Fruit::Type::Bell:
+                fruit->getSprite().setTextureRect(ime::UIntRect{103, 116, 16, 16}); // 3000
+                break;
+            case Fruit::Type::Key:
+                fruit->getSprite().setTextureRect(ime::UIntRect{120, 116, 16, 16}); // 5000
+                break;
+        }
+
+        // Destroy fruit after some seconds have passed since it was replaced by score texture
+        fruitScoreEndTick_ = state_.tick + toTicks(Constants::EATEN_FRUIT_DESTRUCTION_DELAY);
     }
 
     ///////////////////////////////////////////////////////////////
-    void GameplayScene::stopTimers() {
-        chaseModeTimer_.stop();
-        frightenedModeTimer_.stop();
-        scatterModeTimer_.stop();
-        uneatenFruitTimer_.stop();
-        ghostHouseTimer_.stop();
+    void GameplayScene::replaceGhostWithScore(Ghost* ghost, int pointsMultiplier) {
+        // Freeze Animations to prevent texture changes while score texture is displayed
+        ghost->getSprite().getAnimator().setTimescale(0.0f);
+        ghost->getSprite().setTexture("spritesheet.png");
+
+        if (pointsMultiplier == 1)
+            ghost->getSprite().setTextureRect(ime::UIntRect{137, 116, 16, 16}); // 200
+        else if (pointsMultiplier == 2)
+            ghost->getSprite().setTextureRect(ime::UIntRect{154, 116, 16, 16}); // 400
+        else if (pointsMultiplier == 4)
+            ghost->getSprite().setTextureRect(ime::UIntRect{171, 116, 16, 16}); // 800
+        else
+            ghost->getSprite().setTextureRect(ime::UIntRect{188, 116, 16, 16}); // 1600
     }
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::flashGhosts() {
-        ime::Time static flashAnimCutoffTime = ime::seconds(2);
-
-        if (frightenedModeTimer_.isRunning()) {
-            getGameObjects().forEachInGroup("Ghost", [this](ime::GameObject* ghostBase) {
-                auto* ghost = static_cast<Ghost*>(ghostBase);
-                if (ghost->getState() == Ghost::State::Frightened) {
-                    if (!ghost->isFlashAnimationPlaying() && frightenedModeTimer_.getRemainingDuration() <= flashAnimCutoffTime)
-                        ghost->playFlashAnimation(true);
-                    else if (ghost->isFlashAnimationPlaying() && frightenedModeTimer_.getRemainingDuration() > flashAnimCutoffTime)
-                        ghost->playFlashAnimation(false);
-                }
-            });
+        if (!state_.timers.isRunning(FrightenedModeTimer))
+            return;
+
+        bool isExpiring = state_.timers.getRemaining(FrightenedModeTimer) <= toTicks(GHOST_FLASH_CUTOFF);
+
+        for (int i = 0; i < GhostCount; i++) {
+            auto id = static_cast<GhostId>(i);
+            auto* ghost = actors_.get<Ghost>(ghosts_[id]);
+            if (ghost && !isGhostCaught(id) && ghost->getState() == Ghost::State::Frightened && ghost->isFlashAnimationPlaying() != isExpiring)
+                ghost->playFlashAnimation(isExpiring);
         }
     }
 
     ///////////////////////////////////////////////////////////////
-    void GameplayScene::updatePointsMultiplier() {
-        if (pointsMultiplier_ == 8)
-            pointsMultiplier_ = 1; // Also resets to 1 when power mode timer expires
-        else
-            pointsMultiplier_ *= 2;
+    void GameplayScene::onPause() {
+        getWindow().suspendedEventListener(onWindowCloseId_, true);
+        getAudio().pauseAll();
+    }
+
+    ///////////////////////////////////////////////////////////////
+    void GameplayScene::onResume() {
+        setOnPauseAction(ime::Scene::OnPauseAction::Default);
+        getWindow().suspendedEventListener(onWindowCloseId_, false);
+        getAudio().setMasterVolume(getSCache().getPref("MASTER_VOLUME").getValue<float>());
+        getAudio().playAll();
     }
 
     ///////////////////////////////////////////////////////////////
     void GameplayScene::onExit() {
-        ObjectReferenceKeeper::clear();
-        stopTimers();
+        actors_.clear();
         getWindow().removeEventListener(onWindowCloseId_);
     }
 
     ///////////////////////////////////////////////////////////////
-    GameplayScene::~GameplayScene() {
-        ObjectReferenceKeeper::clear();
-    }
+    GameplayScene::~GameplayScene() = default;
 
-} // namespace pm
\ No newline at end of file
+} // namespace pm
@@ -26,15 +26,26 @@
 #define PACMAN_GAMEPLAYSCENE_H
 
 #include "Grid2D/Grid.h"
-#include "Common/GameEvents.h"
+#include "Common/ActorRegistry.h"
+#include "Core/Maze.h"
+#include "Core/LevelRules.h"
+#include "Core/Simulation.h"
 #include "Views/GameplaySceneView.h"
 #include <IME/core/scene/Scene.h>
+#include <cstdint>
+#include <utility>
+#include <vector>
 
 namespace pm {
-    class CollisionResponseRegisterer;
+    class Ghost;
 
     /**
      * @brief Defines the playing state of the game
+     *
+     * The scene plays a level by advancing a pm::GameState with the same
+     * pm::Simulation the headless modes use. Pacman, the ghosts, the
+     * pellets and the fruit only present that state, they do not apply
+     * any gameplay rule of their own
      */
     class GameplayScene : public ime::Scene {
     public:
@@ -72,7 +83,8 @@ namespace pm {
          * @param deltaTime Time passed since last update
          *
          * This function is called by the game engine when it is time to
-         * update. Note that @a deltaTime is frame rate dependent
+         * update. Note that @a deltaTime is frame rate dependent, the game
+         * itself is advanced in steps of pm::Simulation::TIMESTEP
          */
         void onUpdate(ime::Time deltaTime) override;
 
@@ -101,19 +113,23 @@ namespace pm {
         void initGui();
 
         /**
-         * @brief Create the gameplay grid
+         * @brief Create the gameplay grid and load the maze
          */
         void createGrid();
 
         /**
-         * @brief Add GameObjects to the grid
+         * @brief Load the level rules and start the game state at the
+         *        current level
+         *
+         * The score and the lives are carried from level to level in the
+         * engine cache, everything else starts afresh with the level
          */
-        void createActors();
+        void initGameState();
 
         /**
-         * @brief Create PathFinders controllers for pacman and the ghosts
+         * @brief Add GameObjects to the grid
          */
-        void createGridMovers();
+        void createActors();
 
         /**
          * @brief Initialize game events
@@ -121,32 +137,56 @@ namespace pm {
         void intiGameEvents();
 
         /**
-         * @brief Initialize movable GameObjects collision responses
+         * @brief Get the direction a key moves pacman in
+         * @param key The key that was pressed
+         * @return The direction bound to @a key or Dir::None if the key
+         *         is not a movement key
+         */
+        Dir getInputDirection(ime::Keyboard::Key key) const;
+
+        /**
+         * @brief Update the views after the game advanced by a step
+         * @param prevState The state of the game before the step
          */
-        void initCollisionResponses();
+        void onStep(const GameState& prevState);
+
+        /**
+         * @brief Update the views when the game enters a new phase
+         */
+        void onPhaseChange();
 
         /**
          * @brief Start the level start countdown
          */
         void startCountDown();
 
+        /**
+         * @brief Hand control to the player when the countdown ends
+         */
+        void endCountDown();
+
         /**
          * @brief Transition game to pause menu
          */
         void pauseGame();
 
         /**
-         * @brief Flash the gameplay grid and advance to the next level
+         * @brief Freeze the level after the last pellet is eaten
+         */
+        void freezeLevel();
+
+        /**
+         * @brief Flash the gameplay grid
          */
         void completeLevel();
 
         /**
-         * @brief Restarts the game level without restoring eaten pellets
+         * @brief Replace the scene with the scene of the next level
          */
-        void resetLevel();
+        void startNextLevel();
 
         /**
-         * @brief Reset pacman and the ghosts to their respective spawn tiles
+         * @brief Show the ghosts again after pacman lost a life
          */
         void resetActors();
 
@@ -158,129 +198,123 @@ namespace pm {
         void endGameplay();
 
         /**
-         * @brief Update the game Grid2D before playing death animation
+         * @brief Remove pacman from the grid and destroy him
          */
-        void onPrePacmanDeathAnim();
+        void removePacMan();
 
         /**
-         * @brief Update the game Grid2D after death animation finished playing
+         * @brief Hide the ghosts and play pacman's death sound
          */
-        void onPostPacmanDeathAnim();
+        void onPacManDeath();
 
         /**
-         * @brief Update cache and view score values
-         * @param points The points to update the score by
+         * @brief Remove the pellets the simulation reports as eaten
          */
-        void updateScore(int points);
+        void updatePellets();
 
         /**
-         * @brief Emit a game event
-         * @param event The event to be emitted
+         * @brief Spawn, replace or remove the fruit as the simulation reports
+         * @param prevState The state of the game before the last step
          */
-        void emit(GameEvent event);
+        void updateFruit(const GameState& prevState);
 
         /**
-         * @brief Set the speed of pacman
-         * @param pacmam PacMan
+         * @brief Show the points of the ghosts pacman caught in the last step
+         * @param prevState The state of the game before the last step
          */
-        void updatePacmanSpeed(ime::GridObject* pacmam) const;
+        void updateCaughtGhosts(const GameState& prevState);
 
         /**
-         * @brief Set the speed of a ghost
-         * @param ghost The Ghost
+         * @brief Update cache and view score values
+         * @param prevState The state of the game before the last step
          */
-        void updateGhostSpeed(ime::GridObject* ghost) const;
+        void updateScore(const GameState& prevState);
 
         /**
-         * @brief Start the ghost frightened mode timer
-         *
-         * Note that if the timer is paused, it will be resumed instead
-         * of being reset
+         * @brief Update cache and view lives
+         * @param prevState The state of the game before the last step
          */
-        void startGhostFrightenedMode();
+        void updateLives(const GameState& prevState);
 
         /**
-         * @brief Start the ghost scatter chase timer
-         *
-         * Note that if the timer is paused, it will simply be resumed instead
-         * of being reset
+         * @brief Move pacman and the ghosts to their simulated positions
+         *        and show their states
          */
-        void startGhostScatterMode();
+        void updateActors();
 
         /**
-         * @brief Start the ghost chase mode timer
-         *
-         * Note that if the timer is paused, it will simply be resumed instead
-         * of being reset
+         * @brief Move pacman and the ghosts to the tiles they entered in
+         *        the last step
+         * @param prevState The state of the game before the last step
          */
-        void startGhostChaseMode();
+        void updateActorTiles(const GameState& prevState);
 
         /**
-         * @brief Attempt to lock a ghost in the ghost house
-         * @param ghost The ghost to be locked inside
+         * @brief Move an actor to its simulated position
+         * @param actor The actor to be moved
+         * @param mover The simulated movement of the actor
          */
-        void lockGhostInHouse(ime::GridObject* ghost);
+        void updateActorPosition(ime::GridObject* actor, const MoverState& mover);
 
         /**
-         * @brief Start the timer that controls when a ghost leaves the ghost
-         *        house
-         *
-         * Recall that blinky starts outside pf the ghost house. The remaining
-         * ghosts are released in the following order: pinky, inky then clyde.
+         * @brief Check if a ghost was caught by pacman and waits to be eaten
+         * @param id The ghost to be checked
+         * @return True if the ghost shows its points, otherwise false
          */
-        void startGhostHouseTimer();
+        bool isGhostCaught(GhostId id) const;
 
         /**
-         * @brief Stop all active timers
+         * @brief Add the fruit of the level to the grid
          */
-        void stopTimers();
+        void spawnFruit();
 
         /**
-         * @brief Make ghosts flash
+         * @brief Remove the fruit from the grid
          *
-         * Note that a ghost only flashes when in pm::FrightenedState. The
-         * flash is a visual cue to the player that the energizer is about
-         * to expire
+         * This function has no effect if there is no fruit in the grid
          */
-        void flashGhosts();
+        void removeFruit();
 
         /**
-         * @brief Freeze or unfreeze the PathFinders of pacman and the ghosts
-         * @param freeze True to freeze or false to unfreeze the PathFinders
+         * @brief Replace the fruit with the points it was worth
          */
-        void setMovementFreeze(bool freeze);
+        void replaceFruitWithScore();
 
         /**
-         * @brief Update the ghost point multiplier
+         * @brief Replace a caught ghost with the points it was worth
+         * @param ghost The ghost that was caught
+         * @param pointsMultiplier The multiplier the points were awarded with
+         */
+        void replaceGhostWithScore(Ghost* ghost, int pointsMultiplier);
+
+        /**
+         * @brief Make ghosts flash
          *
-         * The multiplier increases by a factor of 2 every time the player
-         * eats a ghost. However, since the player cannot eat more than four
-         * ghosts in a single power mode session, the multiplier is capped to
-         * 8. After the player eats the 4th ghost, the multiplier resets
-         * to 1 (default). It also resets to 1 when power mode expires
+         * Note that a ghost only flashes when frightened. The flash is a
+         * visual cue to the player that the energizer is about to expire
          */
-        void updatePointsMultiplier();
+        void flashGhosts();
 
     private:
-        int currentLevel_;                  //!< Current game level
-        int pointsMultiplier_;              //!< Ghost points multiplier when player eats ghosts in succession (in one power mode session)
-        int eatenPelletsCount_;             //!< Keeps track of the number of pellets pacman has eaten
-        static int extraLivesGiven_;        //!< Keeps track of the number of extra lives the player has been awarded with
-        GameplaySceneView view_;            //!< Scene view without the gameplay grid
-        std::unique_ptr<Grid> grid_;        //!< Gameplay grid view
-        ime::Timer frightenedModeTimer_;    //!< Controls the duration of the ghosts frightened state
-        ime::Timer scatterModeTimer_;       //!< Controls the duration of the ghosts scatter state
-        ime::Timer chaseModeTimer_;         //!< Controls the duration of the ghosts chase state
-        ime::Timer ghostHouseTimer_;        //!< Controls when a ghost should leave the ghost house
-        ime::Timer uneatenFruitTimer_;      //!< Controls how long an uneaten fruit remains on the screen before being destroyed
-        unsigned int chaseModeWaveLevel_;   //!< Stores the current ghost chase wave level (up to 5)
-        unsigned int scatterModeWaveLevel_; //!< Stores the current scatter mode level (up to 4)
-        unsigned int numGhostsInHouse_;     //!< The number of ghosts currently in the ghost house
-        int onWindowCloseId_;               //!< The id number of the 'onClose' event handler
-        static inline bool isBoot_ = true;  //!< A flag indicating whether the game just booted or not (is set to false after the first countdown)
-        std::unique_ptr<CollisionResponseRegisterer> collisionResponseRegisterer_;
-
-        friend class CollisionResponseRegisterer;
+        int currentLevel_;                                 //!< The level the scene plays
+        static int extraLivesGiven_;                       //!< Keeps track of the number of extra lives the player has been awarded with
+        GameplaySceneView view_;                           //!< Scene view without the gameplay grid
+        std::unique_ptr<Grid> grid_;                       //!< Gameplay grid view
+        Maze maze_;                                        //!< The maze the simulation plays the level in
+        LevelRules levelRules_;                            //!< The speeds, durations and fruits of each level
+        Simulation simulation_;                            //!< Applies the gameplay rules to the game state
+        GameState state_;                                  //!< The state of the game the scene presents
+        float unsimulatedTime_;                            //!< Time (in seconds) that passed but was not simulated yet
+        Dir input_;                                        //!< The direction the player pressed since the last step
+        ActorRegistry actors_;                             //!< Provides handle based access to the actors of the level
+        ActorHandle pacman_;                               //!< Pacman
+        ActorHandle ghosts_[GhostCount];                   //!< The ghosts, indexed by pm::GhostId
+        ActorHandle fruit_;                                //!< The fruit, if there is one in the grid
+        std::vector<std::pair<int, ActorHandle>> pellets_; //!< The uneaten pellets and the ids of their tiles (see pm::Maze::toTileId)
+        std::uint64_t fruitScoreEndTick_;                  //!< The step in which the points of an eaten fruit disappear, or 0 if none are shown
+        std::uint64_t levelCompleteTick_;                  //!< The step in which the last pellet was eaten
+        int onWindowCloseId_;                              //!< The id number of the 'onClose' event handler
+        static inline bool isBoot_ = true;                 //!< A flag indicating whether the game just booted or not (is set to false after the first countdown)
     };
 }
 
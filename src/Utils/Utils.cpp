@@ -39,4 +39,44 @@ namespace pm::utils {
             return "Unknown";
     }
 
+    ///////////////////////////////////////////////////////////////
+    Dir convertToDir(ime::Direction direction) {
+        if (direction == ime::Up)
+            return Dir::Up;
+        else if (direction == ime::Left)
+            return Dir::Left;
+        else if (direction == ime::Down)
+            return Dir::Down;
+        else if (direction == ime::Right)
+            return Dir::Right;
+        else
+            return Dir::None;
+    }
+
+    ///////////////////////////////////////////////////////////////
+    ime::Direction convertToDirection(Dir dir) {
+        switch (dir) {
+            case Dir::Up:
+                return ime::Up;
+            case Dir::Left:
+                return ime::Left;
+            case Dir::Down:
+                return ime::Down;
+            case Dir::Right:
+                return ime::Right;
+            default:
+                return ime::Unknown;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    ime::Index convertToIndex(TileIndex index) {
+        return ime::Index{index.row, index.colm};
+    }
+
+    ///////////////////////////////////////////////////////////////
+    TileIndex convertToTileIndex(ime::Index index) {
+        return TileIndex{index.row, index.colm};
+    }
+
 } // namespace pm
@@ -25,6 +25,7 @@
 #ifndef PACMAN_UTILS_H
 #define PACMAN_UTILS_H
 
+#include "Grid2D/MazeTypes.h"
 #include <IME/core/grid/Grid2D.h>
 #include <IME/core/physics/grid/GridMover.h>
 #include <unordered_map>
@@ -41,6 +42,35 @@ namespace pm::utils {
      * @return A string version of ime::Direction
      */
     extern std::string convertToString(ime::Direction direction);
+
+    /**
+     * @brief Convert ime::Direction to pm::Dir
+     * @param direction The direction to be converted
+     * @return The pm::Dir equivalent of @a direction or pm::Dir::None if
+     *         @a direction is not one of the four non-diagonal directions
+     */
+    extern Dir convertToDir(ime::Direction direction);
+
+    /**
+     * @brief Convert pm::Dir to ime::Direction
+     * @param dir The direction to be converted
+     * @return The ime::Direction equivalent of @a dir
+     */
+    extern ime::Direction convertToDirection(Dir dir);
+
+    /**
+     * @brief Convert pm::TileIndex to ime::Index
+     * @param index The tile position to be converted
+     * @return The ime::Index equivalent of @a index
+     */
+    extern ime::Index convertToIndex(TileIndex index);
+
+    /**
+     * @brief Convert ime::Index to pm::TileIndex
+     * @param index The tile position to be converted
+     * @return The pm::TileIndex equivalent of @a index
+     */
+    extern TileIndex convertToTileIndex(ime::Index index);
 }
 
 #endif
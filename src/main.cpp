@@ -1,10 +1,20 @@
 #include "Game.h"
+#include "Headless/HeadlessGame.h"
 
 #ifdef NDEBUG
     #include "windows.h"
 #endif
 
-int main() {
+int main(int argc, char* argv[]) {
+
+    // Run the game without a window, rendering or audio
+    if (pm::HeadlessGame::isRequested(argc, argv)) {
+        pm::HeadlessGame headlessGame{};
+        if (!headlessGame.initialize(argc, argv))
+            return 1;
+
+        return headlessGame.start() ? 0 : 1;
+    }
 
     // Hide console window in release mode
 #ifdef NDEBUG